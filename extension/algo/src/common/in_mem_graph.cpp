@@ -1,8 +1,26 @@
 #include "common/in_mem_graph.h"
 
+#include <algorithm>
+
+#include "common/in_mem_gds_utils.h"
+#include "graph/graph.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::graph;
+using namespace kuzu::processor;
+
 namespace kuzu {
 namespace algo_extension {
 
+InMemNodeIDMap::InMemNodeIDMap(Graph* graph, transaction::Transaction* transaction) {
+    for (const auto tableID : graph->getNodeTableIDs()) {
+        startIds[tableID] = numNodes;
+        numNodes += graph->getMaxOffset(transaction, tableID);
+    }
+}
+
 InMemGraph::InMemGraph(const common::offset_t numNodes, storage::MemoryManager* mm)
     : csrOffsets(mm), csrEdges(mm) {
     reinit(numNodes);
@@ -25,5 +43,126 @@ void InMemGraph::insertNbr(const common::offset_t to, const weight_t weight) {
     numEdges++;
 }
 
+// Scans the neighbors of the nodes of one node table. In the counting pass, stores the degree of
+// node `id` at `csrOffsets[id + 1]`. In the filling pass, writes the neighbors of node `id` from
+// `csrOffsets[id]` on. Both passes must visit the neighbors in the same order.
+class InMemGraphBuildVC final : public InMemParallelCompute {
+public:
+    InMemGraphBuildVC(Graph* graph, const InMemNodeIDMap& nodeIDMap, InMemGraph& inMemGraph,
+        const std::vector<GraphRelInfo>& fwdRelInfos,
+        const std::vector<GraphRelInfo>& bwdRelInfos, bool fill)
+        : graph{graph}, nodeIDMap{nodeIDMap}, inMemGraph{inMemGraph}, fwdRelInfos{fwdRelInfos},
+          bwdRelInfos{bwdRelInfos}, fill{fill} {}
+    ~InMemGraphBuildVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        if (!initialized) {
+            // Set randomLookup to false to enable caching during graph materialization.
+            for (auto& info : fwdRelInfos) {
+                fwdScanStates.push_back(graph->prepareRelScan(*info.relGroupEntry,
+                    info.relTableID, info.dstTableID, {}, false /*randomLookup*/));
+            }
+            for (auto& info : bwdRelInfos) {
+                bwdScanStates.push_back(graph->prepareRelScan(*info.relGroupEntry,
+                    info.relTableID, info.srcTableID, {}, false /*randomLookup*/));
+            }
+            initialized = true;
+        }
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const nodeID_t nodeID = {offset, tableID.value()};
+            const auto id = nodeIDMap.getId(nodeID);
+            auto pos = fill ? inMemGraph.csrOffsets[id] : 0;
+            auto insert = [&](const offset_t nbrId) {
+                if (fill) {
+                    inMemGraph.csrEdges[pos] = Neighbor(nbrId, DEFAULT_WEIGHT);
+                }
+                pos++;
+            };
+            for (auto& scanState : fwdScanStates) {
+                for (auto chunk : graph->scanFwd(nodeID, *scanState)) {
+                    chunk.forEach([&](auto neighbors, auto, auto i) {
+                        insert(nodeIDMap.getId(neighbors[i]));
+                    });
+                }
+            }
+            for (auto& scanState : bwdScanStates) {
+                for (auto chunk : graph->scanBwd(nodeID, *scanState)) {
+                    chunk.forEach([&](auto neighbors, auto, auto i) {
+                        const auto nbrId = nodeIDMap.getId(neighbors[i]);
+                        // Self-loops are already inserted by the forward scan.
+                        if (nbrId != id) {
+                            insert(nbrId);
+                        }
+                    });
+                }
+            }
+            if (fill) {
+                KU_ASSERT(pos == inMemGraph.csrOffsets[id + 1]);
+            } else {
+                inMemGraph.csrOffsets[id + 1] = pos;
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<InMemGraphBuildVC>(graph, nodeIDMap, inMemGraph, fwdRelInfos,
+            bwdRelInfos, fill);
+    }
+
+private:
+    Graph* graph;
+    const InMemNodeIDMap& nodeIDMap;
+    InMemGraph& inMemGraph;
+    const std::vector<GraphRelInfo>& fwdRelInfos;
+    const std::vector<GraphRelInfo>& bwdRelInfos;
+    bool fill;
+    bool initialized = false;
+    std::vector<std::unique_ptr<NbrScanState>> fwdScanStates;
+    std::vector<std::unique_ptr<NbrScanState>> bwdScanStates;
+};
+
+void InMemGraph::build(Graph* graph, const InMemNodeIDMap& nodeIDMap, ExecutionContext* context) {
+    reinit(nodeIDMap.numNodes);
+    csrOffsets.resize(numNodes + 1);
+    csrOffsets[0] = 0;
+    const auto transaction = transaction::Transaction::Get(*context->clientContext);
+    table_id_map_t<std::vector<GraphRelInfo>> fwdRelInfos;
+    table_id_map_t<std::vector<GraphRelInfo>> bwdRelInfos;
+    for (const auto tableID : graph->getNodeTableIDs()) {
+        for (auto& info : graph->getRelInfos(tableID)) {
+            fwdRelInfos[info.srcTableID].push_back(info);
+            bwdRelInfos[info.dstTableID].push_back(info);
+        }
+    }
+    for (const auto fill : {false, true}) {
+        if (fill) {
+            for (auto id = 0u; id < numNodes; ++id) {
+                csrOffsets[id + 1] += csrOffsets[id];
+            }
+            numEdges = csrOffsets[numNodes];
+            csrEdges.resize(numEdges);
+        }
+        for (const auto tableID : graph->getNodeTableIDs()) {
+            InMemGraphBuildVC buildVC(graph, nodeIDMap, *this, fwdRelInfos[tableID],
+                bwdRelInfos[tableID], fill);
+            InMemGDSUtils::runParallelCompute(buildVC, graph->getMaxOffset(transaction, tableID),
+                context, tableID);
+        }
+    }
+}
+
+offset_t InMemGraph::sortUniqueNbrs(offset_t id) {
+    auto begin = csrEdges.begin() + csrOffsets[id];
+    auto end = csrEdges.begin() + csrOffsets[id + 1];
+    std::sort(begin, end,
+        [](const Neighbor& a, const Neighbor& b) { return a.neighbor < b.neighbor; });
+    end = std::unique(begin, end,
+        [](const Neighbor& a, const Neighbor& b) { return a.neighbor == b.neighbor; });
+    end = std::remove_if(begin, end, [&](const Neighbor& nbr) { return nbr.neighbor == id; });
+    return end - begin;
+}
+
 } // namespace algo_extension
 } // namespace kuzu
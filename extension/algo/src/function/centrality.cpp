@@ -0,0 +1,493 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/random_engine.h"
+#include "common/string_utils.h"
+#include "function/algo_function.h"
+#include "function/config/centrality_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Betweenness and closeness centrality. Both run one BFS per source node over the undirected
+// in-memory graph without self-loops and parallel edges, so reciprocal or parallel rels count as a
+// single edge. The BFSs from different sources run in parallel. Betweenness follows Brandes, "A
+// Faster Algorithm for Betweenness Centrality": the BFS counts the shortest paths from the source
+// to each node, then the nodes are walked back in the reverse BFS order to accumulate the
+// dependency of the source on each node. Results follow the definitions of NetworkX for undirected
+// graphs.
+
+namespace kuzu {
+namespace algo_extension {
+
+struct BetweennessOptionalParams final : public OptionalParams {
+    OptionalParam<NumSamples> numSamples;
+    OptionalParam<Normalized> normalized;
+
+    explicit BetweennessOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    BetweennessOptionalParams(OptionalParam<NumSamples> numSamples,
+        OptionalParam<Normalized> normalized)
+        : numSamples{std::move(numSamples)}, normalized{std::move(normalized)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        numSamples.evaluateParam(context);
+        normalized.evaluateParam(context);
+    }
+
+    std::unique_ptr<OptionalParams> copy() override {
+        return std::make_unique<BetweennessOptionalParams>(numSamples, normalized);
+    }
+};
+
+BetweennessOptionalParams::BetweennessOptionalParams(const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == NumSamples::NAME) {
+            numSamples = OptionalParam<NumSamples>(optionalParam);
+        } else if (paramName == Normalized::NAME) {
+            normalized = OptionalParam<Normalized>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct ClosenessOptionalParams final : public OptionalParams {
+    OptionalParam<Harmonic> harmonic;
+
+    explicit ClosenessOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    explicit ClosenessOptionalParams(OptionalParam<Harmonic> harmonic)
+        : harmonic{std::move(harmonic)} {}
+
+    void evaluateParams(main::ClientContext* context) override { harmonic.evaluateParam(context); }
+
+    std::unique_ptr<OptionalParams> copy() override {
+        return std::make_unique<ClosenessOptionalParams>(harmonic);
+    }
+};
+
+ClosenessOptionalParams::ClosenessOptionalParams(const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == Harmonic::NAME) {
+            harmonic = OptionalParam<Harmonic>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct CentralityBindData final : public GDSBindData {
+    CentralityBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput, std::unique_ptr<OptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CentralityBindData>(*this);
+    }
+};
+
+struct CentralityState {
+    InMemGraph graph;
+    // Number of distinct neighbors of each node, ignoring self-loops and parallel edges. These are
+    // sorted at the front of the neighbors of each node in the in-memory graph.
+    ku_vector_t<offset_t> degrees;
+    // Ids of the nodes to run a BFS from.
+    std::vector<offset_t> sources;
+    AtomicObjectArray<double> centralities;
+
+    CentralityState(offset_t numNodes, MemoryManager* mm)
+        : graph{numNodes, mm}, degrees{mm, numNodes},
+          centralities{numNodes, mm, true /* initializeToZero */} {}
+
+    const Neighbor* getNbrs(offset_t id) const {
+        return std::to_address(graph.csrEdges.begin()) + graph.csrOffsets[id];
+    }
+};
+
+// Drops self-loops and parallel edges, so that every edge is counted once in the number of
+// shortest paths, whichever directions the rels between its endpoints have. Nodes filtered out of
+// the projected graph get no neighbors.
+class UniqueNbrsVC final : public InMemParallelCompute {
+public:
+    UniqueNbrsVC(CentralityState& state, const InMemNodeIDMap& nodeIDMap,
+        NodeOffsetMaskMap* nodeMask)
+        : state{state}, nodeIDMap{nodeIDMap}, nodeMask{nodeMask} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        SemiMask* mask = nullptr;
+        if (nodeMask != nullptr && nodeMask->containsTableID(tableID.value())) {
+            mask = nodeMask->getOffsetMask(tableID.value());
+        }
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto id = nodeIDMap.getId({offset, tableID.value()});
+            if (mask != nullptr && !mask->isMasked(offset)) {
+                state.degrees[id] = 0;
+                continue;
+            }
+            state.degrees[id] = state.graph.sortUniqueNbrs(id);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<UniqueNbrsVC>(state, nodeIDMap, nodeMask);
+    }
+
+private:
+    CentralityState& state;
+    const InMemNodeIDMap& nodeIDMap;
+    NodeOffsetMaskMap* nodeMask;
+};
+
+static constexpr uint64_t UNREACHED = UINT64_MAX;
+
+// Runs the BFSs from the sources in the range of each morsel, one at a time. The per source
+// values are allocated once per thread and only the entries of the nodes reached are reset after
+// each BFS.
+class CentralityBFSCompute : public InMemParallelCompute {
+public:
+    CentralityBFSCompute(CentralityState& state, MemoryManager* mm)
+        : state{state}, mm{mm}, levels{mm}, order{mm} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        if (levels.empty()) {
+            levels.resize(state.graph.numNodes);
+            std::fill(levels.begin(), levels.end(), UNREACHED);
+            allocateValues();
+        }
+        for (auto i = startOffset; i < endOffset; ++i) {
+            const auto source = state.sources[i];
+            beginSource(source);
+            runBFS(source);
+            endSource(source);
+            for (auto id : order) {
+                levels[id] = UNREACHED;
+                resetValues(id);
+            }
+            order.clear();
+        }
+    }
+
+protected:
+    virtual void allocateValues() {}
+    virtual void beginSource(offset_t) {}
+    // Called for every edge from a node to a node of the next level.
+    virtual void onShortestPathEdge(offset_t, offset_t) {}
+    // Called once the BFS from the source is done.
+    virtual void endSource(offset_t source) = 0;
+    virtual void resetValues(offset_t) {}
+
+private:
+    void runBFS(offset_t source) {
+        levels[source] = 0;
+        order.push_back(source);
+        for (auto i = 0u; i < order.size(); ++i) {
+            const auto id = order[i];
+            const auto nbrs = state.getNbrs(id);
+            for (auto j = 0u; j < state.degrees[id]; ++j) {
+                const auto nbr = nbrs[j].neighbor;
+                if (levels[nbr] == UNREACHED) {
+                    levels[nbr] = levels[id] + 1;
+                    order.push_back(nbr);
+                }
+                if (levels[nbr] == levels[id] + 1) {
+                    onShortestPathEdge(id, nbr);
+                }
+            }
+        }
+    }
+
+protected:
+    CentralityState& state;
+    MemoryManager* mm;
+    // Distance from the source to each node.
+    ku_vector_t<uint64_t> levels;
+    // Nodes reached by the BFS, in the order they are reached.
+    ku_vector_t<offset_t> order;
+};
+
+// Follows Brandes: the BFS counts the shortest paths from the source to each node, then the nodes
+// are visited in the reverse order to accumulate the dependency of the source on each node.
+class BrandesCompute final : public CentralityBFSCompute {
+public:
+    BrandesCompute(CentralityState& state, MemoryManager* mm)
+        : CentralityBFSCompute{state, mm}, sigmas{mm}, deltas{mm} {}
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<BrandesCompute>(state, mm);
+    }
+
+private:
+    void allocateValues() override {
+        sigmas.resize(state.graph.numNodes);
+        deltas.resize(state.graph.numNodes);
+        std::fill(sigmas.begin(), sigmas.end(), 0);
+        std::fill(deltas.begin(), deltas.end(), 0);
+    }
+
+    void beginSource(offset_t source) override { sigmas[source] = 1; }
+
+    void onShortestPathEdge(offset_t id, offset_t nbr) override { sigmas[nbr] += sigmas[id]; }
+
+    // The source itself is skipped as it lies on no path from itself.
+    void endSource(offset_t) override {
+        for (auto i = order.size(); i-- > 1;) {
+            const auto id = order[i];
+            const auto nbrs = state.getNbrs(id);
+            auto delta = 0.0;
+            for (auto j = 0u; j < state.degrees[id]; ++j) {
+                const auto nbr = nbrs[j].neighbor;
+                if (levels[nbr] == levels[id] + 1) {
+                    delta += sigmas[id] / sigmas[nbr] * (1 + deltas[nbr]);
+                }
+            }
+            deltas[id] = delta;
+            if (delta != 0) {
+                state.centralities.fetchAdd(id, delta, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void resetValues(offset_t id) override {
+        sigmas[id] = 0;
+        deltas[id] = 0;
+    }
+
+private:
+    // Number of shortest paths from the source to each node.
+    ku_vector_t<double> sigmas;
+    // Dependency of the source on each node, i.e. the fraction of the shortest paths from the
+    // source through the node, summed over all destinations.
+    ku_vector_t<double> deltas;
+};
+
+class ClosenessCompute final : public CentralityBFSCompute {
+public:
+    ClosenessCompute(CentralityState& state, MemoryManager* mm, bool harmonic)
+        : CentralityBFSCompute{state, mm}, harmonic{harmonic} {}
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<ClosenessCompute>(state, mm, harmonic);
+    }
+
+private:
+    void endSource(offset_t source) override {
+        uint64_t sumDistances = 0;
+        auto sumInverseDistances = 0.0;
+        for (auto i = 1u; i < order.size(); ++i) {
+            const auto level = levels[order[i]];
+            sumDistances += level;
+            sumInverseDistances += 1.0 / level;
+        }
+        auto centrality = 0.0;
+        if (harmonic) {
+            centrality = sumInverseDistances;
+        } else if (sumDistances > 0) {
+            double numReached = order.size() - 1;
+            centrality = numReached / sumDistances * numReached / (state.sources.size() - 1);
+        }
+        state.centralities.set(source, centrality, std::memory_order_relaxed);
+    }
+
+private:
+    bool harmonic;
+};
+
+class CentralityResultVertexCompute final : public GDSResultVertexCompute {
+public:
+    CentralityResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        CentralityState& state, const InMemNodeIDMap& nodeIDMap, double scale)
+        : GDSResultVertexCompute{mm, sharedState}, state{state}, nodeIDMap{nodeIDMap},
+          scale{scale} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        centralityVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            auto nodeID = nodeID_t{i, tableID};
+            nodeIDVector->setValue<nodeID_t>(0, nodeID);
+            centralityVector->setValue<double>(0,
+                state.centralities.get(nodeIDMap.getId(nodeID), std::memory_order_relaxed) *
+                    scale);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<CentralityResultVertexCompute>(mm, sharedState, state, nodeIDMap,
+            scale);
+    }
+
+private:
+    CentralityState& state;
+    const InMemNodeIDMap& nodeIDMap;
+    double scale;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> centralityVector;
+};
+
+// Builds the in-memory graph without self-loops and parallel edges and collects the nodes of the
+// projected graph as sources.
+static void initState(CentralityState& state, Graph* graph, const InMemNodeIDMap& nodeIDMap,
+    NodeOffsetMaskMap* nodeMask, ExecutionContext* context) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    state.graph.build(graph, nodeIDMap, context);
+    for (const auto tableID : graph->getNodeTableIDs()) {
+        UniqueNbrsVC uniqueNbrsVC(state, nodeIDMap, nodeMask);
+        auto maxOffset = graph->getMaxOffset(transaction, tableID);
+        InMemGDSUtils::runParallelCompute(uniqueNbrsVC, maxOffset, context, tableID);
+        SemiMask* mask = nullptr;
+        if (nodeMask != nullptr && nodeMask->containsTableID(tableID)) {
+            mask = nodeMask->getOffsetMask(tableID);
+        }
+        for (auto offset = 0u; offset < maxOffset; ++offset) {
+            if (mask == nullptr || mask->isMasked(offset)) {
+                state.sources.push_back(nodeIDMap.getId({offset, tableID}));
+            }
+        }
+    }
+}
+
+static offset_t betweennessTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto bindData = input.bindData->constPtrCast<CentralityBindData>();
+    auto& config = bindData->optionalParams->constCast<BetweennessOptionalParams>();
+    // Nodes of all node tables are numbered consecutively in the in-memory graph.
+    const InMemNodeIDMap nodeIDMap(graph, transaction);
+    CentralityState state(nodeIDMap.numNodes, mm);
+    initState(state, graph, nodeIDMap, sharedState->getGraphNodeMaskMap(), input.context);
+    auto& sources = state.sources;
+    auto numNodes = sources.size();
+    auto numSamples = static_cast<uint64_t>(config.numSamples.getParamVal());
+    if (numSamples > 0 && numSamples < numNodes) {
+        // Partial Fisher-Yates shuffle picking numSamples distinct sources.
+        auto randomEngine = RandomEngine::Get(*clientContext);
+        for (auto i = 0u; i < numSamples; ++i) {
+            auto j = i + randomEngine->nextRandomInteger(static_cast<uint32_t>(numNodes - i));
+            std::swap(sources[i], sources[j]);
+        }
+        sources.resize(numSamples);
+    }
+    BrandesCompute brandesCompute(state, mm);
+    InMemGDSUtils::runParallelCompute(brandesCompute, sources.size(), input.context);
+    // Every path is counted from both of its ends.
+    double scale = 0.5;
+    if (config.normalized.getParamVal()) {
+        scale = numNodes > 2 ? 1.0 / ((numNodes - 1) * (numNodes - 2)) : 1;
+    }
+    if (!sources.empty() && sources.size() < numNodes) {
+        scale *= static_cast<double>(numNodes) / sources.size();
+    }
+    auto resultVC = CentralityResultVertexCompute(mm, sharedState, state, nodeIDMap, scale);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, resultVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static offset_t closenessTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto bindData = input.bindData->constPtrCast<CentralityBindData>();
+    auto harmonic =
+        bindData->optionalParams->constCast<ClosenessOptionalParams>().harmonic.getParamVal();
+    const InMemNodeIDMap nodeIDMap(graph, transaction);
+    CentralityState state(nodeIDMap.numNodes, mm);
+    initState(state, graph, nodeIDMap, sharedState->getGraphNodeMaskMap(), input.context);
+    ClosenessCompute closenessCompute(state, mm, harmonic);
+    InMemGDSUtils::runParallelCompute(closenessCompute, state.sources.size(), input.context);
+    auto resultVC =
+        CentralityResultVertexCompute(mm, sharedState, state, nodeIDMap, 1 /* scale */);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, resultVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char BETWEENNESS_COLUMN_NAME[] = "betweenness";
+static constexpr char CLOSENESS_COLUMN_NAME[] = "closeness";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& columnName,
+    std::unique_ptr<OptionalParams> optionalParams) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(columnName, LogicalType::DOUBLE()));
+    return std::make_unique<CentralityBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::move(optionalParams));
+}
+
+static std::unique_ptr<TableFuncBindData> betweennessBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, BETWEENNESS_COLUMN_NAME,
+        std::make_unique<BetweennessOptionalParams>(input->optionalParamsLegacy));
+}
+
+static std::unique_ptr<TableFuncBindData> closenessBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, CLOSENESS_COLUMN_NAME,
+        std::make_unique<ClosenessOptionalParams>(input->optionalParamsLegacy));
+}
+
+static std::unique_ptr<TableFunction> getFunction(const char* name, table_func_bind_t bindFunc,
+    table_func_t tableFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+function_set BetweennessCentralityFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, betweennessBindFunc, betweennessTableFunc));
+    return result;
+}
+
+function_set ClosenessCentralityFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, closenessBindFunc, closenessTableFunc));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
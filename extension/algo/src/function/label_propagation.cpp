@@ -0,0 +1,226 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/max_iterations_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Label propagation (Raghavan et al., "Near linear time algorithm to detect community structures
+// in large-scale networks"). Every node starts in its own community and repeatedly adopts the
+// label carried by most of its neighbors, counting its own label as one more vote. Edges are
+// treated as undirected. Labels are updated synchronously: all nodes compute their next label
+// from the labels of the previous iteration in parallel, and ties go to the smallest label, so
+// the result does not depend on scheduling. The algorithm stops once no label changes.
+
+namespace kuzu {
+namespace algo_extension {
+
+struct LabelPropagationBindData final : public GDSBindData {
+    LabelPropagationBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<MaxIterationOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<LabelPropagationBindData>(*this);
+    }
+};
+
+struct LabelPropagationState {
+    InMemGraph graph;
+    ku_vector_t<offset_t> labels1;
+    ku_vector_t<offset_t> labels2;
+    ku_vector_t<offset_t>* labels = &labels1;
+    ku_vector_t<offset_t>* nextLabels = &labels2;
+    std::atomic<offset_t> numChanged = 0;
+
+    LabelPropagationState(offset_t numNodes, MemoryManager* mm)
+        : graph{numNodes, mm}, labels1{mm, numNodes}, labels2{mm, numNodes} {
+        for (auto id = 0u; id < numNodes; ++id) {
+            labels1[id] = id;
+        }
+    }
+};
+
+// Computes the next label of the nodes of one node table. Nodes filtered out of the projected
+// graph keep their label, which no other node sees.
+class UpdateLabelsVC final : public InMemParallelCompute {
+public:
+    UpdateLabelsVC(LabelPropagationState& state, const InMemNodeIDMap& nodeIDMap,
+        NodeOffsetMaskMap* nodeMask)
+        : state{state}, nodeIDMap{nodeIDMap}, nodeMask{nodeMask} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        SemiMask* mask = nullptr;
+        if (nodeMask != nullptr && nodeMask->containsTableID(tableID.value())) {
+            mask = nodeMask->getOffsetMask(tableID.value());
+        }
+        offset_t numChanged = 0;
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto id = nodeIDMap.getId({offset, tableID.value()});
+            const auto label = (*state.labels)[id];
+            if (mask != nullptr && !mask->isMasked(offset)) {
+                (*state.nextLabels)[id] = label;
+                continue;
+            }
+            const auto nextLabel = getMostFrequentLabel(id);
+            numChanged += nextLabel != label;
+            (*state.nextLabels)[id] = nextLabel;
+        }
+        state.numChanged.fetch_add(numChanged, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<UpdateLabelsVC>(state, nodeIDMap, nodeMask);
+    }
+
+private:
+    offset_t getMostFrequentLabel(offset_t id) {
+        nbrLabels.clear();
+        const auto& labels = *state.labels;
+        const auto& graph = state.graph;
+        nbrLabels.push_back(labels[id]);
+        for (auto i = graph.csrOffsets[id]; i < graph.csrOffsets[id + 1]; ++i) {
+            nbrLabels.push_back(labels[graph.csrEdges[i].neighbor]);
+        }
+        std::sort(nbrLabels.begin(), nbrLabels.end());
+        auto result = nbrLabels[0];
+        uint64_t maxCount = 0;
+        for (auto i = 0u; i < nbrLabels.size();) {
+            auto j = i;
+            while (j < nbrLabels.size() && nbrLabels[j] == nbrLabels[i]) {
+                j++;
+            }
+            if (j - i > maxCount) {
+                maxCount = j - i;
+                result = nbrLabels[i];
+            }
+            i = j;
+        }
+        return result;
+    }
+
+private:
+    LabelPropagationState& state;
+    const InMemNodeIDMap& nodeIDMap;
+    NodeOffsetMaskMap* nodeMask;
+    std::vector<offset_t> nbrLabels;
+};
+
+class LabelPropagationResultVC final : public GDSResultVertexCompute {
+public:
+    LabelPropagationResultVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const ku_vector_t<offset_t>& labels, const InMemNodeIDMap& nodeIDMap)
+        : GDSResultVertexCompute{mm, sharedState}, labels{labels}, nodeIDMap{nodeIDMap} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        labelVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            auto nodeID = nodeID_t{i, tableID};
+            nodeIDVector->setValue<nodeID_t>(0, nodeID);
+            labelVector->setValue<int64_t>(0, labels[nodeIDMap.getId(nodeID)]);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LabelPropagationResultVC>(mm, sharedState, labels, nodeIDMap);
+    }
+
+private:
+    const ku_vector_t<offset_t>& labels;
+    const InMemNodeIDMap& nodeIDMap;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> labelVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto bindData = input.bindData->constPtrCast<LabelPropagationBindData>();
+    auto& config = bindData->optionalParams->constCast<MaxIterationOptionalParams>();
+    // Nodes of all node tables are numbered consecutively in the in-memory graph.
+    const InMemNodeIDMap nodeIDMap(graph, transaction);
+    LabelPropagationState state(nodeIDMap.numNodes, mm);
+    state.graph.build(graph, nodeIDMap, input.context);
+    auto maxIterations = config.maxIterations.getParamVal();
+    for (auto iter = 0; iter < maxIterations; ++iter) {
+        state.numChanged.store(0, std::memory_order_relaxed);
+        for (const auto tableID : graph->getNodeTableIDs()) {
+            UpdateLabelsVC updateLabelsVC(state, nodeIDMap, sharedState->getGraphNodeMaskMap());
+            InMemGDSUtils::runParallelCompute(updateLabelsVC,
+                graph->getMaxOffset(transaction, tableID), input.context, tableID);
+        }
+        std::swap(state.labels, state.nextLabels);
+        if (state.numChanged.load(std::memory_order_relaxed) == 0) {
+            break;
+        }
+        auto progress = static_cast<double>(iter + 1) / maxIterations;
+        ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, progress);
+    }
+    auto vertexCompute = LabelPropagationResultVC(mm, sharedState, *state.labels, nodeIDMap);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char LABEL_COLUMN_NAME[] = "label";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(LABEL_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<LabelPropagationBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::make_unique<MaxIterationOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set LabelPropagationFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -1,5 +1,4 @@
 #include "binder/binder.h"
-#include "common/exception/runtime.h"
 #include "common/in_mem_gds_utils.h"
 #include "common/in_mem_graph.h"
 #include "common/string_utils.h"
@@ -136,27 +135,8 @@ struct PhaseState {
 
     void startNewIter(MemoryManager* mm, ExecutionContext* context);
 
-    // Initializes the next node in the sequence before inserting edges for the node.
-    void initNextNode(const offset_t nodeId) {
-        graph.initNextNode();
-        // Each community starts with one node.
-        currCommInfos.getUnsafe(nodeId).size.store(1, memory_order_relaxed);
-        currCommInfos.getUnsafe(nodeId).degree.store(0, memory_order_relaxed);
-        // Each node starts in its own community.
-        acceptedComm.set(nodeId, nodeId, memory_order_relaxed);
-        currComm.set(nodeId, nodeId, memory_order_relaxed);
-    }
-
-    // Inserts a neighbor of the last initialized node.
-    void insertNbr(const offset_t from, const offset_t to, const weight_t weight = DEFAULT_WEIGHT) {
-        graph.insertNbr(to, weight);
-        nodeWeightedDegrees.fetchAdd(from, weight, memory_order_relaxed);
-        // The weightedDegree of each community is the weightedDegree of its single node.
-        currCommInfos.getUnsafe(from).degree.fetch_add(weight, memory_order_relaxed);
-        totalWeight += weight;
-    }
-
-    void finalize() { graph.initNextNode(); }
+    // Places every node of `graph` in its own community and computes the weighted degrees.
+    void initCommunities(ExecutionContext* context);
 };
 
 class ResetPhaseStateVC final : public InMemParallelCompute {
@@ -218,6 +198,50 @@ void PhaseState::reinit(const offset_t numNodes, MemoryManager* mm, ExecutionCon
     InMemGDSUtils::runParallelCompute(resetPhaseStateVC, numNodes, context);
 }
 
+class InitCommunitiesVC final : public InMemParallelCompute {
+public:
+    InitCommunitiesVC(PhaseState& state, std::atomic<weight_t>& totalWeight)
+        : state{state}, totalWeight{totalWeight} {}
+    ~InitCommunitiesVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        weight_t totalWeightLocal = 0;
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            weight_t degree = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                degree += state.graph.csrEdges[offset].weight;
+            }
+            state.nodeWeightedDegrees.set(nodeId, degree, memory_order_relaxed);
+            // Each community starts with one node, so its weightedDegree is the weightedDegree of
+            // its single node.
+            state.currCommInfos.getUnsafe(nodeId).size.store(1, memory_order_relaxed);
+            state.currCommInfos.getUnsafe(nodeId).degree.store(degree, memory_order_relaxed);
+            // Each node starts in its own community.
+            state.acceptedComm.set(nodeId, nodeId, memory_order_relaxed);
+            state.currComm.set(nodeId, nodeId, memory_order_relaxed);
+            totalWeightLocal += degree;
+        }
+        totalWeight.fetch_add(totalWeightLocal);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<InitCommunitiesVC>(state, totalWeight);
+    }
+
+private:
+    PhaseState& state;
+    std::atomic<weight_t>& totalWeight;
+};
+
+void PhaseState::initCommunities(ExecutionContext* context) {
+    std::atomic<weight_t> sumWeights{0};
+    InitCommunitiesVC initCommunitiesVC(*this, sumWeights);
+    InMemGDSUtils::runParallelCompute(initCommunitiesVC, graph.numNodes, context);
+    totalWeight = sumWeights.load();
+}
+
 void PhaseState::startNewIter(MemoryManager* mm, ExecutionContext* context) {
     selfCommWeights.reallocate(graph.numNodes, mm);
     nextCommInfos.reallocate(graph.numNodes, mm);
@@ -463,8 +487,10 @@ private:
 
 class WriteResultsVC final : public GDSResultVertexCompute {
 public:
-    WriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState, FinalResults& louvainState)
-        : GDSResultVertexCompute{mm, sharedState}, finalResults{louvainState} {
+    WriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState, FinalResults& louvainState,
+        const InMemNodeIDMap& nodeIDMap)
+        : GDSResultVertexCompute{mm, sharedState}, finalResults{louvainState},
+          nodeIDMap{nodeIDMap} {
         nodeIDVector = createVector(LogicalType::INTERNAL_ID());
         componentIDVector = createVector(LogicalType::UINT64());
     }
@@ -476,51 +502,23 @@ public:
         for (auto i = startOffset; i < endOffset; ++i) {
             const auto nodeID = nodeID_t{i, tableID};
             nodeIDVector->setValue<nodeID_t>(0, nodeID);
-            componentIDVector->setValue<uint64_t>(0, finalResults.communities[i]);
+            componentIDVector->setValue<uint64_t>(0,
+                finalResults.communities[nodeIDMap.getId(nodeID)]);
             localFT->append(vectors);
         }
     }
 
     unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<WriteResultsVC>(mm, sharedState, finalResults);
+        return std::make_unique<WriteResultsVC>(mm, sharedState, finalResults, nodeIDMap);
     }
 
 private:
     FinalResults& finalResults;
+    const InMemNodeIDMap& nodeIDMap;
     unique_ptr<ValueVector> nodeIDVector;
     unique_ptr<ValueVector> componentIDVector;
 };
 
-void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
-    PhaseState& state) {
-    const auto nbrTables = graph->getRelInfos(tableId);
-    const auto nbrInfo = nbrTables[0];
-    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
-    // Set randomLookup to false to enable caching during graph materialization.
-    const auto scanState = graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID,
-        nbrInfo.dstTableID, {}, false /*randomLookup*/);
-
-    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
-        state.initNextNode(nodeId);
-        const nodeID_t nextNodeId = {nodeId, tableId};
-        for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
-            chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrId = neighbors[i].offset;
-                state.insertNbr(nodeId, nbrId);
-            });
-        }
-        for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
-            chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrId = neighbors[i].offset;
-                if (nbrId != nodeId) {
-                    state.insertNbr(nodeId, nbrId);
-                }
-            });
-        }
-    }
-    state.finalize();
-}
-
 // Sequentially renumber the communities, each of which becomes a new node in the next phase.
 offset_t renumberCommunities(PhaseState& state) {
     unordered_map<offset_t, offset_t> map;
@@ -563,12 +561,13 @@ void aggregateCommunities(const offset_t newCommCount, PhaseState& state, Memory
     }
     state.reinit(newCommCount, mm, context);
     for (auto nodeId = 0u; nodeId < newCommCount; nodeId++) {
-        state.initNextNode(nodeId);
+        state.graph.initNextNode();
         for (auto [nbrId, weight] : commWeights[nodeId]) {
-            state.insertNbr(nodeId, nbrId, weight);
+            state.graph.insertNbr(nbrId, weight);
         }
     }
-    state.finalize();
+    state.graph.initNextNode();
+    state.initCommunities(context);
 }
 
 static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
@@ -577,10 +576,9 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
     auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
     auto mm = MemoryManager::Get(*clientContext);
     const auto graph = sharedState->graph.get();
-    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
-    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
-    const auto tableID = graph->getNodeTableIDs()[0];
-    const auto origNumNodes = graph->getMaxOffset(transaction, tableID);
+    // Nodes of all node tables are numbered consecutively in the in-memory graph.
+    const InMemNodeIDMap nodeIDMap(graph, transaction);
+    const auto origNumNodes = nodeIDMap.numNodes;
 
     auto louvainBindData = input.bindData->constPtrCast<LouvainBindData>();
     auto& config = louvainBindData->optionalParams->constCast<LouvainOptionalParams>();
@@ -592,7 +590,8 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
     PhaseState state(origNumNodes, mm, input.context);
 
     // Create the initial in-memory graph.
-    initInMemoryGraph(tableID, origNumNodes, graph, state);
+    state.graph.build(graph, nodeIDMap, input.context);
+    state.initCommunities(input.context);
 
     // Each phases attempts to decrease the number of communities by merging nodes into supernodes.
     for (auto phase = 0u; phase < config.maxPhases.getParamVal(); ++phase) {
@@ -660,7 +659,8 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
         aggregateCommunities(newCommCount, state, mm, input.context);
     }
 
-    const auto parallelCompute = make_unique<WriteResultsVC>(mm, sharedState, finalResults);
+    const auto parallelCompute = make_unique<WriteResultsVC>(mm, sharedState, finalResults,
+        nodeIDMap);
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *parallelCompute);
 
     sharedState->factorizedTablePool.mergeLocalTables();
@@ -673,12 +673,6 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     const TableFuncBindInput* input) {
     const auto graphName = input->getLiteralVal<std::string>(0);
     auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
-    if (graphEntry.nodeInfos.size() != 1) {
-        throw RuntimeException("Louvain only supports operations on one node table.");
-    }
-    if (graphEntry.relInfos.size() != 1) {
-        throw RuntimeException("Louvain only supports operations on one edge table.");
-    }
     expression_vector columns;
     auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
     columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
@@ -1,7 +1,12 @@
 #include "binder/binder.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/random_engine.h"
 #include "common/string_utils.h"
 #include "common/task_system/progress_bar.h"
+#include "common/types/value/nested.h"
 #include "function/algo_function.h"
 #include "function/config/max_iterations_config.h"
 #include "function/config/page_rank_config.h"
@@ -10,9 +15,12 @@
 #include "function/gds/gds_vertex_compute.h"
 #include "function/table/bind_input.h"
 #include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::processor;
+using namespace kuzu::catalog;
 using namespace kuzu::common;
 using namespace kuzu::binder;
 using namespace kuzu::storage;
@@ -26,26 +34,29 @@ struct PageRankOptionalParams final : public MaxIterationOptionalParams {
     OptionalParam<DampingFactor> dampingFactor;
     OptionalParam<Tolerance> tolerance;
     OptionalParam<NormalizeInitial> normalize;
+    OptionalParam<PullBased> pull;
 
     explicit PageRankOptionalParams(const expression_vector& optionalParams);
 
     // For copy only
     PageRankOptionalParams(OptionalParam<MaxIterations> maxIterations,
         OptionalParam<DampingFactor> dampingFactor, OptionalParam<Tolerance> tolerance,
-        OptionalParam<NormalizeInitial> normalize)
+        OptionalParam<NormalizeInitial> normalize, OptionalParam<PullBased> pull)
         : MaxIterationOptionalParams{maxIterations}, dampingFactor{std::move(dampingFactor)},
-          tolerance{std::move(tolerance)}, normalize{std::move(normalize)} {}
+          tolerance{std::move(tolerance)}, normalize{std::move(normalize)},
+          pull{std::move(pull)} {}
 
     void evaluateParams(main::ClientContext* context) override {
         MaxIterationOptionalParams::evaluateParams(context);
         dampingFactor.evaluateParam(context);
         tolerance.evaluateParam(context);
         normalize.evaluateParam(context);
+        pull.evaluateParam(context);
     }
 
     std::unique_ptr<function::OptionalParams> copy() override {
         return std::make_unique<PageRankOptionalParams>(maxIterations, dampingFactor, tolerance,
-            normalize);
+            normalize, pull);
     }
 };
 
@@ -61,6 +72,8 @@ PageRankOptionalParams::PageRankOptionalParams(const expression_vector& optional
             tolerance = function::OptionalParam<Tolerance>(optionalParam);
         } else if (paramName == NormalizeInitial::NAME) {
             normalize = function::OptionalParam<NormalizeInitial>(optionalParam);
+        } else if (paramName == PullBased::NAME) {
+            pull = function::OptionalParam<PullBased>(optionalParam);
         } else {
             throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
         }
@@ -80,6 +93,69 @@ struct PageRankBindData final : public GDSBindData {
     }
 };
 
+struct PersonalizedPageRankOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<DampingFactor> dampingFactor;
+    OptionalParam<Tolerance> tolerance;
+    OptionalParam<NumWalks> numWalks;
+
+    explicit PersonalizedPageRankOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    PersonalizedPageRankOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<DampingFactor> dampingFactor, OptionalParam<Tolerance> tolerance,
+        OptionalParam<NumWalks> numWalks)
+        : MaxIterationOptionalParams{maxIterations}, dampingFactor{std::move(dampingFactor)},
+          tolerance{std::move(tolerance)}, numWalks{std::move(numWalks)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        dampingFactor.evaluateParam(context);
+        tolerance.evaluateParam(context);
+        numWalks.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<PersonalizedPageRankOptionalParams>(maxIterations, dampingFactor,
+            tolerance, numWalks);
+    }
+};
+
+PersonalizedPageRankOptionalParams::PersonalizedPageRankOptionalParams(
+    const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == DampingFactor::NAME) {
+            dampingFactor = function::OptionalParam<DampingFactor>(optionalParam);
+        } else if (paramName == MaxIterations::NAME) {
+            continue;
+        } else if (paramName == Tolerance::NAME) {
+            tolerance = function::OptionalParam<Tolerance>(optionalParam);
+        } else if (paramName == NumWalks::NAME) {
+            numWalks = function::OptionalParam<NumWalks>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct PersonalizedPageRankBindData final : public GDSBindData {
+    // Primary keys of the seed nodes.
+    std::vector<Value> seedKeys;
+
+    PersonalizedPageRankBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput, std::vector<Value> seedKeys,
+        std::unique_ptr<PersonalizedPageRankOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}},
+          seedKeys{std::move(seedKeys)} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PersonalizedPageRankBindData>(*this);
+    }
+};
+
 static void addCAS(std::atomic<double>& origin, double valToAdd) {
     auto expected = origin.load(std::memory_order_relaxed);
     auto desired = expected + valToAdd;
@@ -103,6 +179,8 @@ public:
 
     void pinTable(table_id_t tableID) { values = valueMap.getData(tableID); }
 
+    std::atomic<double>* getData(table_id_t tableID) { return valueMap.getData(tableID); }
+
     double getValue(offset_t offset) { return values[offset].load(std::memory_order_relaxed); }
 
     void addValueCAS(offset_t offset, double val) { addCAS(values[offset], val); }
@@ -194,6 +272,40 @@ private:
     PValues& pNext;
 };
 
+// Evaluate rank = above result * dampingFactor + restart, where restart is
+// (1 - dampingFactor) / |seeds| for seed nodes and 0 otherwise.
+class PersonalizedPNextUpdateVertexCompute : public GDSVertexCompute {
+public:
+    PersonalizedPNextUpdateVertexCompute(double dampingFactor, PValues& restart, PValues& pNext,
+        NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, dampingFactor{dampingFactor}, restart{restart},
+          pNext{pNext} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        restart.pinTable(tableID);
+        pNext.pinTable(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            pNext.setValue(i, pNext.getValue(i) * dampingFactor + restart.getValue(i));
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<PersonalizedPNextUpdateVertexCompute>(dampingFactor, restart,
+            pNext, nodeMask);
+    }
+
+private:
+    double dampingFactor;
+    PValues& restart;
+    PValues& pNext;
+};
+
 class PDiffVertexCompute : public GDSVertexCompute {
 public:
     PDiffVertexCompute(std::atomic<double>& diff, PValues& pCurrent, PValues& pNext,
@@ -231,6 +343,189 @@ private:
     PValues& pNext;
 };
 
+// Computes the contribution (current rank / degree) each node passes to each of its outgoing
+// neighbours, so that the pull kernel reads one value per edge.
+class ContributionVertexCompute : public GDSVertexCompute {
+public:
+    ContributionVertexCompute(Degrees& degrees, PValues& pCurrent, PValues& contributions,
+        NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, degrees{degrees}, pCurrent{pCurrent},
+          contributions{contributions} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        degrees.pinTable(tableID);
+        pCurrent.pinTable(tableID);
+        contributions.pinTable(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            const auto degree = degrees.getValue(i);
+            // Nodes without outgoing edges are never pulled from.
+            contributions.setValue(i, degree == 0 ? 0 : pCurrent.getValue(i) / degree);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<ContributionVertexCompute>(degrees, pCurrent, contributions,
+            nodeMask);
+    }
+
+private:
+    Degrees& degrees;
+    PValues& pCurrent;
+    PValues& contributions;
+};
+
+// Pull-based rank update. Every node sums the contributions of its incoming neighbours in scan
+// order and writes its new rank and its share of the rank difference without atomic
+// read-modify-writes on the ranks. This also fuses the PNextUpdate and PDiff passes of the push
+// kernel.
+class PullRankVertexCompute : public GDSVertexCompute {
+public:
+    PullRankVertexCompute(Graph* graph, double dampingFactor, double constant,
+        PValues& contributions, PValues& pCurrent, PValues& pNext, std::atomic<double>& diff,
+        NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, graph{graph}, dampingFactor{dampingFactor},
+          constant{constant}, contributions{contributions}, pCurrent{pCurrent}, pNext{pNext},
+          diff{diff} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        pCurrent.pinTable(tableID);
+        pNext.pinTable(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        if (tableID != scanTableID) {
+            prepareScans(tableID);
+        }
+        double localDiff = 0;
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            const auto nodeID = nodeID_t{i, tableID};
+            double sum = 0;
+            for (auto j = 0u; j < scanStates.size(); ++j) {
+                const auto nbrContributions = nbrContributionValues[j];
+                for (auto chunk : graph->scanBwd(nodeID, *scanStates[j])) {
+                    chunk.forEach([&](auto neighbors, auto, auto k) {
+                        sum += nbrContributions[neighbors[k].offset].load(
+                            std::memory_order_relaxed);
+                    });
+                }
+            }
+            const auto next = sum * dampingFactor + constant;
+            localDiff += std::abs(next - pCurrent.getValue(i));
+            pNext.setValue(i, next);
+        }
+        addCAS(diff, localDiff);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<PullRankVertexCompute>(graph, dampingFactor, constant,
+            contributions, pCurrent, pNext, diff, nodeMask);
+    }
+
+private:
+    void prepareScans(table_id_t tableID) {
+        scanStates.clear();
+        nbrContributionValues.clear();
+        for (const auto nodeTableID : graph->getNodeTableIDs()) {
+            for (auto& info : graph->getRelInfos(nodeTableID)) {
+                if (info.dstTableID != tableID) {
+                    continue;
+                }
+                scanStates.push_back(graph->prepareRelScan(*info.relGroupEntry, info.relTableID,
+                    info.srcTableID, {}));
+                nbrContributionValues.push_back(contributions.getData(info.srcTableID));
+            }
+        }
+        scanTableID = tableID;
+    }
+
+private:
+    Graph* graph;
+    double dampingFactor;
+    double constant;
+    PValues& contributions;
+    PValues& pCurrent;
+    PValues& pNext;
+    std::atomic<double>& diff;
+    table_id_t scanTableID = INVALID_TABLE_ID;
+    std::vector<std::unique_ptr<NbrScanState>> scanStates;
+    std::vector<std::atomic<double>*> nbrContributionValues;
+};
+
+// Monte-Carlo estimate of personalized PageRank (Fogaras et al., "Towards Scaling Fully
+// Personalized PageRank"). A walk starts at a seed and, at each node it visits, follows a random
+// outgoing edge with probability dampingFactor or stops. The rank of a node is (1 - dampingFactor)
+// times its expected number of visits per walk, which is what power iteration converges to. Walks
+// are split evenly among the seeds.
+class RandomWalkCompute final : public InMemParallelCompute {
+public:
+    RandomWalkCompute(Graph* graph, const std::vector<nodeID_t>& seeds, double dampingFactor,
+        uint64_t randomSeed, double visitWeight, PValues& ranks)
+        : graph{graph}, seeds{seeds}, dampingFactor{dampingFactor}, randomSeed{randomSeed},
+          visitWeight{visitWeight}, ranks{ranks},
+          continueThreshold{static_cast<uint64_t>(dampingFactor * (1ull << 32))} {}
+
+    void parallelCompute(const offset_t startWalk, const offset_t endWalk,
+        const std::optional<table_id_t>&) override {
+        for (auto walk = startWalk; walk < endWalk; ++walk) {
+            // Each walk draws from its own stream so that results do not depend on scheduling.
+            auto randomEngine = RandomEngine(randomSeed, walk);
+            auto nodeID = seeds[walk % seeds.size()];
+            while (true) {
+                addCAS(ranks.getData(nodeID.tableID)[nodeID.offset], visitWeight);
+                if (randomEngine.nextRandomInteger() >= continueThreshold) {
+                    break;
+                }
+                auto& nbrs = getNbrs(nodeID);
+                if (nbrs.empty()) {
+                    break;
+                }
+                nodeID = nbrs[randomEngine.nextRandomInteger(static_cast<uint32_t>(nbrs.size()))];
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<RandomWalkCompute>(graph, seeds, dampingFactor, randomSeed,
+            visitWeight, ranks);
+    }
+
+private:
+    const std::vector<nodeID_t>& getNbrs(nodeID_t nodeID) {
+        if (!scanStates.contains(nodeID.tableID)) {
+            auto& states = scanStates[nodeID.tableID];
+            for (auto& info : graph->getRelInfos(nodeID.tableID)) {
+                states.push_back(graph->prepareRelScan(*info.relGroupEntry, info.relTableID,
+                    info.dstTableID, {}));
+            }
+        }
+        nbrs.clear();
+        for (auto& scanState : scanStates.at(nodeID.tableID)) {
+            for (auto chunk : graph->scanFwd(nodeID, *scanState)) {
+                chunk.forEach([&](auto neighbors, auto, auto i) { nbrs.push_back(neighbors[i]); });
+            }
+        }
+        return nbrs;
+    }
+
+private:
+    Graph* graph;
+    const std::vector<nodeID_t>& seeds;
+    double dampingFactor;
+    uint64_t randomSeed;
+    double visitWeight;
+    PValues& ranks;
+    // A walk continues if a random 32-bit integer is below the threshold.
+    uint64_t continueThreshold;
+    table_id_map_t<std::vector<std::unique_ptr<NbrScanState>>> scanStates;
+    std::vector<nodeID_t> nbrs;
+};
+
 class PageRankResultVertexCompute : public GDSResultVertexCompute {
 public:
     PageRankResultVertexCompute(storage::MemoryManager* mm, GDSFuncSharedState* sharedState,
@@ -291,23 +586,36 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
     auto computeState = GDSComputeState(std::move(frontierPair), nullptr, nullptr);
     auto pNextUpdateConstant = (1 - config.dampingFactor.getParamVal()) * initialValue;
+    auto contributions = PValues(maxOffsetMap, mm, 0);
     while (currentIter < config.maxIterations.getParamVal()) {
-        computeState.frontierPair->resetCurrentIter();
-        computeState.frontierPair->setActiveNodesForNextIter();
-        computeState.edgeCompute =
-            std::make_unique<PNextUpdateEdgeCompute>(degrees, *pCurrent, *pNext);
-        computeState.auxiliaryState =
-            std::make_unique<PageRankAuxiliaryState>(degrees, *pCurrent, *pNext);
-        GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, ExtendDirection::BWD,
-            1);
-        auto pNextUpdateVC = PNextUpdateVertexCompute(config.dampingFactor.getParamVal(),
-            pNextUpdateConstant, *pNext, sharedState->getGraphNodeMaskMap());
-        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pNextUpdateVC);
         std::atomic<double> diff;
         diff.store(0);
-        auto pDiffVC =
-            PDiffVertexCompute(diff, *pCurrent, *pNext, sharedState->getGraphNodeMaskMap());
-        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pDiffVC);
+        if (config.pull.getParamVal()) {
+            auto contributionVC = ContributionVertexCompute(degrees, *pCurrent, contributions,
+                sharedState->getGraphNodeMaskMap());
+            GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph,
+                contributionVC);
+            auto pullVC = PullRankVertexCompute(graph, config.dampingFactor.getParamVal(),
+                pNextUpdateConstant, contributions, *pCurrent, *pNext, diff,
+                sharedState->getGraphNodeMaskMap());
+            GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pullVC);
+        } else {
+            computeState.frontierPair->resetCurrentIter();
+            computeState.frontierPair->setActiveNodesForNextIter();
+            computeState.edgeCompute =
+                std::make_unique<PNextUpdateEdgeCompute>(degrees, *pCurrent, *pNext);
+            computeState.auxiliaryState =
+                std::make_unique<PageRankAuxiliaryState>(degrees, *pCurrent, *pNext);
+            GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph,
+                ExtendDirection::BWD, 1);
+            auto pNextUpdateVC = PNextUpdateVertexCompute(config.dampingFactor.getParamVal(),
+                pNextUpdateConstant, *pNext, sharedState->getGraphNodeMaskMap());
+            GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph,
+                pNextUpdateVC);
+            auto pDiffVC =
+                PDiffVertexCompute(diff, *pCurrent, *pNext, sharedState->getGraphNodeMaskMap());
+            GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pDiffVC);
+        }
         std::swap(pCurrent, pNext);
         if (diff.load() < config.tolerance.getParamVal()) { // Converged.
             break;
@@ -351,5 +659,167 @@ function_set PageRankFunction::getFunctionSet() {
     return result;
 }
 
+// Looks up every key in the primary key index of the node tables of the graph whose primary key
+// has the same type. Seeds filtered out of the projected graph are ignored.
+static std::vector<nodeID_t> lookupSeedNodes(main::ClientContext* context, Graph* graph,
+    NodeOffsetMaskMap* nodeMask, const std::vector<Value>& seedKeys) {
+    auto transaction = transaction::Transaction::Get(*context);
+    auto storageManager = StorageManager::Get(*context);
+    std::vector<nodeID_t> result;
+    std::vector<bool> found(seedKeys.size(), false);
+    for (auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+        auto& entry = nodeInfo.entry->constCast<NodeTableCatalogEntry>();
+        auto& pkType = entry.getPrimaryKeyDefinition().getType();
+        auto& table = storageManager->getTable(entry.getTableID())->cast<NodeTable>();
+        auto keyVector = ValueVector(pkType.copy(), MemoryManager::Get(*context));
+        keyVector.state = DataChunkState::getSingleValueDataChunkState();
+        for (auto i = 0u; i < seedKeys.size(); ++i) {
+            if (seedKeys[i].getDataType().getLogicalTypeID() != pkType.getLogicalTypeID()) {
+                continue;
+            }
+            keyVector.copyFromValue(0, seedKeys[i]);
+            offset_t offset = INVALID_OFFSET;
+            if (!table.lookupPK(transaction, &keyVector, 0, offset)) {
+                continue;
+            }
+            found[i] = true;
+            if (nodeMask != nullptr && nodeMask->containsTableID(entry.getTableID()) &&
+                !nodeMask->getOffsetMask(entry.getTableID())->isMasked(offset)) {
+                continue;
+            }
+            result.push_back({offset, entry.getTableID()});
+        }
+    }
+    for (auto i = 0u; i < seedKeys.size(); ++i) {
+        if (!found[i]) {
+            throw RuntimeException{stringFormat("Cannot find seed node with primary key {}.",
+                seedKeys[i].toString())};
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+// Random walk with restart by power iteration: rank = dampingFactor * (sum of rank / degree over
+// incoming edges) + (1 - dampingFactor) / |seeds| for seed nodes. Returns the final ranks.
+static PValues* runPowerIteration(ExecutionContext* context, GDSFuncSharedState* sharedState,
+    const PersonalizedPageRankOptionalParams& config, const std::vector<nodeID_t>& seeds,
+    PValues& p1, PValues& p2) {
+    auto clientContext = context->clientContext;
+    auto graph = sharedState->graph.get();
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext));
+    auto mm = MemoryManager::Get(*clientContext);
+    auto dampingFactor = config.dampingFactor.getParamVal();
+    auto restart = PValues(maxOffsetMap, mm, 0);
+    for (auto& seed : seeds) {
+        p1.pinTable(seed.tableID);
+        p1.setValue(seed.offset, 1.0 / seeds.size());
+        restart.pinTable(seed.tableID);
+        restart.setValue(seed.offset, (1 - dampingFactor) / seeds.size());
+    }
+    PValues* pCurrent = &p1;
+    PValues* pNext = &p2;
+    auto degrees = Degrees(maxOffsetMap, mm);
+    DegreesUtils::computeDegree(context, graph, nodeMask, &degrees, ExtendDirection::FWD);
+    auto currentFrontier = DenseFrontier::getVisitedFrontier(context, graph, nodeMask);
+    auto nextFrontier = DenseFrontier::getVisitedFrontier(context, graph, nodeMask);
+    auto frontierPair =
+        std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
+    auto computeState = GDSComputeState(std::move(frontierPair), nullptr, nullptr);
+    auto maxIterations = config.maxIterations.getParamVal();
+    for (auto currentIter = 1; currentIter < maxIterations; ++currentIter) {
+        std::atomic<double> diff;
+        diff.store(0);
+        computeState.frontierPair->resetCurrentIter();
+        computeState.frontierPair->setActiveNodesForNextIter();
+        computeState.edgeCompute =
+            std::make_unique<PNextUpdateEdgeCompute>(degrees, *pCurrent, *pNext);
+        computeState.auxiliaryState =
+            std::make_unique<PageRankAuxiliaryState>(degrees, *pCurrent, *pNext);
+        GDSUtils::runAlgorithmEdgeCompute(context, computeState, graph, ExtendDirection::BWD, 1);
+        auto pNextUpdateVC =
+            PersonalizedPNextUpdateVertexCompute(dampingFactor, restart, *pNext, nodeMask);
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, pNextUpdateVC);
+        auto pDiffVC = PDiffVertexCompute(diff, *pCurrent, *pNext, nodeMask);
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, pDiffVC);
+        std::swap(pCurrent, pNext);
+        if (diff.load() < config.tolerance.getParamVal()) { // Converged.
+            break;
+        }
+        auto progress = static_cast<double>(currentIter) / maxIterations;
+        ProgressBar::Get(*clientContext)->updateProgress(context->queryID, progress);
+    }
+    return pCurrent;
+}
+
+static offset_t personalizedTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    auto bindData = input.bindData->constPtrCast<PersonalizedPageRankBindData>();
+    auto& config = bindData->optionalParams->constCast<PersonalizedPageRankOptionalParams>();
+    auto seeds = lookupSeedNodes(clientContext, graph, sharedState->getGraphNodeMaskMap(),
+        bindData->seedKeys);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto p1 = PValues(maxOffsetMap, mm, 0);
+    auto p2 = PValues(maxOffsetMap, mm, 0);
+    PValues* ranks = &p1;
+    auto numWalks = config.numWalks.getParamVal();
+    if (numWalks > 0 && !seeds.empty()) {
+        auto dampingFactor = config.dampingFactor.getParamVal();
+        auto randomSeed = RandomEngine::Get(*clientContext)->nextRandomInteger();
+        auto walkCompute = RandomWalkCompute(graph, seeds, dampingFactor, randomSeed,
+            (1 - dampingFactor) / numWalks, p1);
+        InMemGDSUtils::runParallelCompute(walkCompute, numWalks, input.context);
+    } else {
+        ranks = runPowerIteration(input.context, sharedState, config, seeds, p1, p2);
+    }
+    auto outputVC = std::make_unique<PageRankResultVertexCompute>(mm, sharedState, *ranks);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *outputVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> personalizedBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto seedsValue = input->getValue(1);
+    if (seedsValue.getDataType().getLogicalTypeID() != LogicalTypeID::LIST ||
+        NestedVal::getChildrenSize(&seedsValue) == 0) {
+        throw BinderException{"Seed nodes must be given as a non-empty list of primary keys."};
+    }
+    std::vector<Value> seedKeys;
+    for (auto i = 0u; i < NestedVal::getChildrenSize(&seedsValue); ++i) {
+        seedKeys.push_back(*NestedVal::getChildVal(&seedsValue, i));
+    }
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(RANK_COLUMN_NAME, LogicalType::DOUBLE()));
+    return std::make_unique<PersonalizedPageRankBindData>(std::move(columns),
+        std::move(graphEntry), nodeOutput, std::move(seedKeys),
+        std::make_unique<PersonalizedPageRankOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set PersonalizedPageRankFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(PersonalizedPageRankFunction::name,
+        std::vector<LogicalTypeID>{LogicalTypeID::ANY, LogicalTypeID::ANY});
+    func->bindFunc = personalizedBindFunc;
+    func->tableFunc = personalizedTableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
 } // namespace algo_extension
 } // namespace kuzu
@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <memory>
+
+#include "binder/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "function/algo_function.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Triangle counting by degree ordering (Schank & Wagner, "Finding, Counting and Listing all
+// Triangles in Large Graphs"). Edges are treated as undirected and oriented from the endpoint of
+// lower degree to the endpoint of higher degree, so each triangle {u, v, w} with u < v < w in that
+// order is found exactly once by intersecting the sorted out-neighbors of u and v. Orientation
+// bounds the out-degree of every node by O(sqrt(#edges)), which keeps high degree nodes cheap.
+
+namespace kuzu {
+namespace algo_extension {
+
+struct TriangleCountState {
+    InMemGraph graph;
+    // Number of distinct neighbors of each node, ignoring self-loops and parallel edges.
+    ku_vector_t<offset_t> degrees;
+    // Number of neighbors of higher rank. These are sorted at the front of the neighbors of each
+    // node in the in-memory graph once the graph is oriented.
+    ku_vector_t<offset_t> outDegrees;
+    AtomicObjectArray<uint64_t> triangleCounts;
+
+    TriangleCountState(offset_t numNodes, MemoryManager* mm)
+        : graph{numNodes, mm}, degrees{mm, numNodes}, outDegrees{mm, numNodes},
+          triangleCounts{numNodes, mm, true /* initializeToZero */} {}
+
+    // Nodes are ordered by degree, ties broken by id.
+    bool hasHigherRank(offset_t id, offset_t otherId) const {
+        return degrees[id] > degrees[otherId] || (degrees[id] == degrees[otherId] && id > otherId);
+    }
+
+    Neighbor* getNbrs(offset_t id) {
+        return std::to_address(graph.csrEdges.begin()) + graph.csrOffsets[id];
+    }
+};
+
+// Sorts the neighbors of each node by id and drops self-loops and parallel edges. Nodes filtered
+// out of the projected graph get no neighbors.
+class SortNbrsVC final : public InMemParallelCompute {
+public:
+    SortNbrsVC(TriangleCountState& state, const InMemNodeIDMap& nodeIDMap,
+        NodeOffsetMaskMap* nodeMask)
+        : state{state}, nodeIDMap{nodeIDMap}, nodeMask{nodeMask} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>& tableID) override {
+        KU_ASSERT(tableID.has_value());
+        SemiMask* mask = nullptr;
+        if (nodeMask != nullptr && nodeMask->containsTableID(tableID.value())) {
+            mask = nodeMask->getOffsetMask(tableID.value());
+        }
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto id = nodeIDMap.getId({offset, tableID.value()});
+            if (mask != nullptr && !mask->isMasked(offset)) {
+                state.degrees[id] = 0;
+                continue;
+            }
+            state.degrees[id] = state.graph.sortUniqueNbrs(id);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<SortNbrsVC>(state, nodeIDMap, nodeMask);
+    }
+
+private:
+    TriangleCountState& state;
+    const InMemNodeIDMap& nodeIDMap;
+    NodeOffsetMaskMap* nodeMask;
+};
+
+// Moves the neighbors of higher rank to the front of the neighbors of each node, keeping them
+// sorted by id.
+class OrientNbrsVC final : public InMemParallelCompute {
+public:
+    explicit OrientNbrsVC(TriangleCountState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto id = startOffset; id < endOffset; ++id) {
+            auto nbrs = state.getNbrs(id);
+            auto outDegree = 0u;
+            for (auto i = 0u; i < state.degrees[id]; ++i) {
+                if (state.hasHigherRank(nbrs[i].neighbor, id)) {
+                    nbrs[outDegree++] = nbrs[i];
+                }
+            }
+            state.outDegrees[id] = outDegree;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<OrientNbrsVC>(state);
+    }
+
+private:
+    TriangleCountState& state;
+};
+
+// For each oriented edge (u, v), every common out-neighbor w of u and v closes a triangle.
+class CountTrianglesVC final : public InMemParallelCompute {
+public:
+    explicit CountTrianglesVC(TriangleCountState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto u = startOffset; u < endOffset; ++u) {
+            auto uNbrs = state.getNbrs(u);
+            auto uOutDegree = state.outDegrees[u];
+            uint64_t uCount = 0;
+            for (auto i = 0u; i < uOutDegree; ++i) {
+                auto v = uNbrs[i].neighbor;
+                auto vCount = intersect(uNbrs, uOutDegree, state.getNbrs(v), state.outDegrees[v]);
+                if (vCount > 0) {
+                    uCount += vCount;
+                    state.triangleCounts.fetchAdd(v, vCount, std::memory_order_relaxed);
+                }
+            }
+            if (uCount > 0) {
+                state.triangleCounts.fetchAdd(u, uCount, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountTrianglesVC>(state);
+    }
+
+private:
+    // Merges the two sorted lists and credits a triangle to each common neighbor.
+    uint64_t intersect(const Neighbor* left, offset_t leftSize, const Neighbor* right,
+        offset_t rightSize) {
+        uint64_t count = 0;
+        offset_t leftPos = 0, rightPos = 0;
+        while (leftPos < leftSize && rightPos < rightSize) {
+            auto leftNbr = left[leftPos].neighbor;
+            auto rightNbr = right[rightPos].neighbor;
+            if (leftNbr < rightNbr) {
+                leftPos++;
+            } else if (leftNbr > rightNbr) {
+                rightPos++;
+            } else {
+                state.triangleCounts.fetchAdd(leftNbr, 1, std::memory_order_relaxed);
+                count++;
+                leftPos++;
+                rightPos++;
+            }
+        }
+        return count;
+    }
+
+private:
+    TriangleCountState& state;
+};
+
+static void countTriangles(TriangleCountState& state, Graph* graph,
+    const InMemNodeIDMap& nodeIDMap, NodeOffsetMaskMap* nodeMask, ExecutionContext* context) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    state.graph.build(graph, nodeIDMap, context);
+    for (const auto tableID : graph->getNodeTableIDs()) {
+        SortNbrsVC sortNbrsVC(state, nodeIDMap, nodeMask);
+        InMemGDSUtils::runParallelCompute(sortNbrsVC, graph->getMaxOffset(transaction, tableID),
+            context, tableID);
+    }
+    OrientNbrsVC orientNbrsVC(state);
+    InMemGDSUtils::runParallelCompute(orientNbrsVC, nodeIDMap.numNodes, context);
+    CountTrianglesVC countTrianglesVC(state);
+    InMemGDSUtils::runParallelCompute(countTrianglesVC, nodeIDMap.numNodes, context);
+}
+
+class TriangleCountResultVC final : public GDSResultVertexCompute {
+public:
+    TriangleCountResultVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        TriangleCountState& state, const InMemNodeIDMap& nodeIDMap, bool writeCoefficient)
+        : GDSResultVertexCompute{mm, sharedState}, state{state}, nodeIDMap{nodeIDMap},
+          writeCoefficient{writeCoefficient} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        if (writeCoefficient) {
+            valueVector = createVector(LogicalType::DOUBLE());
+        } else {
+            valueVector = createVector(LogicalType::INT64());
+        }
+    }
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            auto nodeID = nodeID_t{i, tableID};
+            auto id = nodeIDMap.getId(nodeID);
+            auto numTriangles = state.triangleCounts.get(id, std::memory_order_relaxed);
+            nodeIDVector->setValue<nodeID_t>(0, nodeID);
+            if (writeCoefficient) {
+                // Fraction of the pairs of neighbors that are connected.
+                auto degree = static_cast<double>(state.degrees[id]);
+                auto coefficient = degree < 2 ? 0 : 2 * numTriangles / (degree * (degree - 1));
+                valueVector->setValue<double>(0, coefficient);
+            } else {
+                valueVector->setValue<int64_t>(0, numTriangles);
+            }
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountResultVC>(mm, sharedState, state, nodeIDMap,
+            writeCoefficient);
+    }
+
+private:
+    TriangleCountState& state;
+    const InMemNodeIDMap& nodeIDMap;
+    bool writeCoefficient;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+};
+
+static offset_t runTriangleCount(const TableFuncInput& input, bool writeCoefficient) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto mm = MemoryManager::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    // Nodes of all node tables are numbered consecutively in the in-memory graph.
+    const InMemNodeIDMap nodeIDMap(graph, transaction);
+    TriangleCountState state(nodeIDMap.numNodes, mm);
+    countTriangles(state, graph, nodeIDMap, sharedState->getGraphNodeMaskMap(), input.context);
+    auto vertexCompute =
+        TriangleCountResultVC(mm, sharedState, state, nodeIDMap, writeCoefficient);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static offset_t triangleCountTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    return runTriangleCount(input, false /* writeCoefficient */);
+}
+
+static offset_t lccTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    return runTriangleCount(input, true /* writeCoefficient */);
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char LCC_COLUMN_NAME[] = "local_clustering_coefficient";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& columnName, LogicalType columnType) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(columnName, std::move(columnType)));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
+        expression_vector{nodeOutput});
+}
+
+static std::unique_ptr<TableFuncBindData> triangleCountBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64());
+}
+
+static std::unique_ptr<TableFuncBindData> lccBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, LCC_COLUMN_NAME, LogicalType::DOUBLE());
+}
+
+static std::unique_ptr<TableFunction> getFunction(const char* name, table_func_bind_t bindFunc,
+    table_func_t tableFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, triangleCountBindFunc, triangleCountTableFunc));
+    return result;
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, lccBindFunc, lccTableFunc));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
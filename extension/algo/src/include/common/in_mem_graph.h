@@ -5,6 +5,16 @@
 #include "function/gds/gds_object_manager.h"
 
 namespace kuzu {
+namespace graph {
+class Graph;
+} // namespace graph
+namespace processor {
+struct ExecutionContext;
+} // namespace processor
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
 namespace algo_extension {
 
 using weight_t = common::offset_t;
@@ -14,10 +24,24 @@ struct Neighbor {
     common::offset_t neighbor;
     weight_t weight;
 
+    Neighbor() = default;
     Neighbor(const common::offset_t neighbor, const weight_t weight)
         : neighbor{neighbor}, weight{weight} {}
 };
 
+// Dense ids of the nodes of all node tables of a graph. The nodes of each node table are numbered
+// consecutively, following the order of `graph::Graph::getNodeTableIDs()`.
+struct InMemNodeIDMap {
+    common::table_id_map_t<common::offset_t> startIds;
+    common::offset_t numNodes = 0;
+
+    InMemNodeIDMap(graph::Graph* graph, transaction::Transaction* transaction);
+
+    common::offset_t getId(const common::nodeID_t& nodeID) const {
+        return startIds.at(nodeID.tableID) + nodeID.offset;
+    }
+};
+
 // CSR-like in-memory representation of an undirected weighted graph. Insert nodes in sequence
 // by first calling `initNextNode()` and then insert all its neighbors using `insertNbr()`.
 // Undirected edges should be explicitly inserted twice.
@@ -40,6 +64,17 @@ struct InMemGraph {
 
     // Inserts a neighbor of the last initialized node.
     void insertNbr(const common::offset_t to, const weight_t weight = DEFAULT_WEIGHT);
+
+    // Re-initializes to the undirected graph of all edges of `graph`, with nodes numbered by
+    // `nodeIDMap`. Every edge is inserted in both directions, except self-loops which are inserted
+    // once. Nodes are processed in parallel with one pass counting degrees and one pass filling
+    // the neighbors after the CSR offsets are computed.
+    void build(graph::Graph* graph, const InMemNodeIDMap& nodeIDMap,
+        processor::ExecutionContext* context);
+
+    // Sorts the neighbors of node `id` by id and drops self-loops and parallel edges. The distinct
+    // neighbors are moved to the front of the neighbors of the node and their number is returned.
+    common::offset_t sortUniqueNbrs(common::offset_t id);
 };
 
 } // namespace algo_extension
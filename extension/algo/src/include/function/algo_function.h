@@ -53,6 +53,18 @@ struct PageRankAliasFunction {
     static constexpr const char* name = "PR";
 };
 
+struct PersonalizedPageRankFunction {
+    static constexpr const char* name = "PERSONALIZED_PAGE_RANK";
+
+    static function::function_set getFunctionSet();
+};
+
+struct PersonalizedPageRankAliasFunction {
+    using alias = PersonalizedPageRankFunction;
+
+    static constexpr const char* name = "PPR";
+};
+
 struct KCoreDecompositionFunction {
     static constexpr const char* name = "K_CORE_DECOMPOSITION";
 
@@ -65,6 +77,18 @@ struct KCoreDecompositionAliasFunction {
     static constexpr const char* name = "KCORE";
 };
 
+struct LabelPropagationFunction {
+    static constexpr const char* name = "LABEL_PROPAGATION";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LabelPropagationAliasFunction {
+    using alias = LabelPropagationFunction;
+
+    static constexpr const char* name = "LPA";
+};
+
 struct LouvainFunction {
     static constexpr const char* name = "LOUVAIN";
 
@@ -83,5 +107,35 @@ struct SpanningForestAliasFunction {
     static constexpr const char* name = "SF";
 };
 
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientAliasFunction {
+    using alias = LocalClusteringCoefficientFunction;
+
+    static constexpr const char* name = "LCC";
+};
+
+struct BetweennessCentralityFunction {
+    static constexpr const char* name = "BETWEENNESS_CENTRALITY";
+
+    static function::function_set getFunctionSet();
+};
+
+struct ClosenessCentralityFunction {
+    static constexpr const char* name = "CLOSENESS_CENTRALITY";
+
+    static function::function_set getFunctionSet();
+};
+
 } // namespace algo_extension
 } // namespace kuzu
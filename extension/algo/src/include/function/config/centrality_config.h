@@ -0,0 +1,41 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace algo_extension {
+
+struct NumSamples {
+    // Number of source nodes sampled to approximate betweenness centrality. Zero runs a BFS from
+    // every node, which gives the exact value.
+    static constexpr const char* NAME = "samples";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+
+    static void validate(int64_t numSamples) {
+        if (numSamples < 0) {
+            throw common::BinderException{"Number of samples must be a non-negative integer."};
+        }
+    }
+};
+
+struct Normalized {
+    // If true, betweenness centrality is divided by the number of node pairs not involving the
+    // node.
+    static constexpr const char* NAME = "normalized";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+struct Harmonic {
+    // If true, closeness centrality is the sum of the inverse distances to all other nodes.
+    // Otherwise, it is the inverse average distance to the reachable nodes, scaled by the fraction
+    // of nodes reached (Wasserman and Faust).
+    static constexpr const char* NAME = "harmonic";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -36,5 +36,27 @@ struct NormalizeInitial {
     static constexpr bool DEFAULT_VALUE = true;
 };
 
+struct PullBased {
+    // If true, every node gathers the contributions of its incoming neighbours and writes its own
+    // rank. Otherwise, contributions are summed into the ranks with atomic additions.
+    static constexpr const char* NAME = "pull";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+struct NumWalks {
+    // Number of random walks used to estimate personalized PageRank. Zero computes it by power
+    // iteration instead.
+    static constexpr const char* NAME = "numwalks";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+
+    static void validate(int64_t numWalks) {
+        if (numWalks < 0) {
+            throw common::BinderException{"Number of walks must be a non-negative integer."};
+        }
+    }
+};
+
 } // namespace function
 } // namespace kuzu
@@ -18,11 +18,20 @@ void AlgoExtension::load(main::ClientContext* context) {
     ExtensionUtils::addTableFuncAlias<WeaklyConnectedComponentsAliasFunction>(db);
     ExtensionUtils::addTableFunc<PageRankFunction>(db);
     ExtensionUtils::addTableFuncAlias<PageRankAliasFunction>(db);
+    ExtensionUtils::addTableFunc<PersonalizedPageRankFunction>(db);
+    ExtensionUtils::addTableFuncAlias<PersonalizedPageRankAliasFunction>(db);
     ExtensionUtils::addTableFunc<KCoreDecompositionFunction>(db);
     ExtensionUtils::addTableFuncAlias<KCoreDecompositionAliasFunction>(db);
     ExtensionUtils::addTableFunc<LouvainFunction>(db);
+    ExtensionUtils::addTableFunc<LabelPropagationFunction>(db);
+    ExtensionUtils::addTableFuncAlias<LabelPropagationAliasFunction>(db);
     ExtensionUtils::addTableFunc<SpanningForest>(db);
     ExtensionUtils::addTableFuncAlias<SpanningForestAliasFunction>(db);
+    ExtensionUtils::addTableFunc<TriangleCountFunction>(db);
+    ExtensionUtils::addTableFunc<LocalClusteringCoefficientFunction>(db);
+    ExtensionUtils::addTableFuncAlias<LocalClusteringCoefficientAliasFunction>(db);
+    ExtensionUtils::addTableFunc<BetweennessCentralityFunction>(db);
+    ExtensionUtils::addTableFunc<ClosenessCentralityFunction>(db);
 }
 
 } // namespace algo_extension
@@ -454,6 +454,7 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     auto [lowerBound, upperBound] = bindVariableLengthRelBound(relPattern);
     bindData->lowerBound = lowerBound;
     bindData->upperBound = upperBound;
+    bindData->hasExplicitUpperBound = !relPattern.getRecursiveInfo()->upperBound.empty();
     // Bind semantic.
     bindData->semantic = QueryRelTypeUtils::getPathSemantic(queryRel->getRelType());
     // Bind path related expressions.
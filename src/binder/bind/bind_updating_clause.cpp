@@ -13,6 +13,8 @@
 #include "common/assert.h"
 #include "common/exception/binder.h"
 #include "common/string_format.h"
+#include "main/client_context.h"
+#include "main/materialized_view.h"
 #include "parser/query/updating_clause/delete_clause.h"
 #include "parser/query/updating_clause/insert_clause.h"
 #include "parser/query/updating_clause/merge_clause.h"
@@ -26,6 +28,20 @@ using namespace kuzu::catalog;
 namespace kuzu {
 namespace binder {
 
+// The table of a materialized view is only written by the view maintainer, whose statements use
+// internal catalog entries.
+static void validateNotMaterializedView(const main::ClientContext& context,
+    const TableCatalogEntry& entry) {
+    if (context.useInternalCatalogEntry()) {
+        return;
+    }
+    if (main::MaterializedViewCatalogEntry::getViewOfTable(*Catalog::Get(context),
+            transaction::Transaction::Get(context), entry.getTableID()) != nullptr) {
+        throw BinderException(stringFormat(
+            "Cannot modify table {} because it stores a materialized view.", entry.getName()));
+    }
+}
+
 std::unique_ptr<BoundUpdatingClause> Binder::bindUpdatingClause(
     const UpdatingClause& updatingClause) {
     switch (updatingClause.getClauseType()) {
@@ -180,6 +196,7 @@ void Binder::bindInsertNode(std::shared_ptr<NodeExpression> node,
     KU_ASSERT(node->getNumEntries() == 1);
     auto entry = node->getEntry(0);
     KU_ASSERT(entry->getTableType() == TableType::NODE);
+    validateNotMaterializedView(*clientContext, *entry);
     auto insertInfo = BoundInsertInfo(TableType::NODE, node);
     for (auto& property : node->getPropertyExpressions()) {
         if (property->hasProperty(entry->getTableID())) {
@@ -307,6 +324,7 @@ BoundSetPropertyInfo Binder::bindSetPropertyInfo(const ParsedExpression* column,
         if (!property.hasProperty(entry->getTableID())) {
             continue;
         }
+        validateNotMaterializedView(*clientContext, *entry);
         auto propertyID = entry->getPropertyID(property.getPropertyName());
         if (catalog->containsUnloadedIndex(transaction, entry->getTableID(), propertyID)) {
             throw BinderException(
@@ -352,6 +370,7 @@ std::unique_ptr<BoundUpdatingClause> Binder::bindDeleteClause(
             auto catalog = Catalog::Get(*clientContext);
             auto transaction = transaction::Transaction::Get(*clientContext);
             for (auto entry : node.getEntries()) {
+                validateNotMaterializedView(*clientContext, *entry);
                 for (auto index : catalog->getIndexEntries(transaction, entry->getTableID())) {
                     if (!index->isLoaded()) {
                         throw BinderException(
@@ -3,11 +3,13 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
 #include "binder/expression/parameter_expression.h"
+#include "binder/expression/scalar_function_expression.h"
 #include "binder/expression_visitor.h"
 #include "common/exception/binder.h"
 #include "common/exception/not_implemented.h"
 #include "common/string_format.h"
 #include "expression_evaluator/expression_evaluator_utils.h"
+#include "function/arithmetic/vector_arithmetic_functions.h"
 #include "function/cast/vector_cast_functions.h"
 #include "parser/expression/parsed_expression_visitor.h"
 #include "parser/expression/parsed_parameter_expression.h"
@@ -19,6 +21,13 @@ using namespace kuzu::parser;
 namespace kuzu {
 namespace binder {
 
+// setseed() changes the random engine of the client while it is folded.
+static bool isSetSeed(const Expression& expression) {
+    return expression.expressionType == ExpressionType::FUNCTION &&
+           expression.constCast<ScalarFunctionExpression>().getFunction().name ==
+               SetSeedFunction::name;
+}
+
 std::shared_ptr<Expression> ExpressionBinder::bindExpression(
     const ParsedExpression& parsedExpression) {
     // Normally u can only reference an existing expression through alias which is a parsed
@@ -59,6 +68,7 @@ std::shared_ptr<Expression> ExpressionBinder::bindExpression(
         expression = bindNullOperatorExpression(parsedExpression);
     } else if (ExpressionType::FUNCTION == expressionType) {
         expression = bindFunctionExpression(parsedExpression);
+        randomFunction |= ExpressionVisitor::isRandom(*expression);
     } else if (ExpressionType::PROPERTY == expressionType) {
         expression = bindPropertyExpression(parsedExpression);
     } else if (ExpressionType::PARAMETER == expressionType) {
@@ -78,6 +88,9 @@ std::shared_ptr<Expression> ExpressionBinder::bindExpression(
             "bindExpression(" + ExpressionTypeUtil::toString(expressionType) + ").");
     }
     if (ConstantExpressionVisitor::needFold(*expression)) {
+        if (expression->getNumChildren() == 0 || isSetSeed(*expression)) {
+            foldedBindTimeFunction = true;
+        }
         return foldExpression(expression);
     }
     return expression;
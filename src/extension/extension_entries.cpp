@@ -27,7 +27,9 @@ static constexpr std::array llmExtensionFunctions = {"CREATE_EMBEDDING"};
 static constexpr std::array neo4jExtensionFunctions = {"NEO4J_MIGRATE"};
 static constexpr std::array algoExtensionFunctions = {"K_CORE_DECOMPOSITION", "PAGE_RANK",
     "STRONGLY_CONNECTED_COMPONENTS_KOSARAJU", "STRONGLY_CONNECTED_COMPONENTS",
-    "WEAKLY_CONNECTED_COMPONENTS"};
+    "WEAKLY_CONNECTED_COMPONENTS", "TRIANGLE_COUNT", "LOCAL_CLUSTERING_COEFFICIENT",
+    "BETWEENNESS_CENTRALITY", "CLOSENESS_CENTRALITY", "PERSONALIZED_PAGE_RANK",
+    "LABEL_PROPAGATION"};
 
 static constexpr EntriesForExtension functionsForExtensionsRaw[] = {
     {"FTS", ftsExtensionFunctions, ftsExtensionFunctions.size()},
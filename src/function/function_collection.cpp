@@ -230,11 +230,18 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(FileInfoFunction), TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
-        TABLE_FUNCTION(ShowMacrosFunction),
+        TABLE_FUNCTION(ShowMacrosFunction), TABLE_FUNCTION(CheckpointInfoFunction),
+        TABLE_FUNCTION(WALInfoFunction), TABLE_FUNCTION(PlanCacheInfoFunction),
+        TABLE_FUNCTION(ResultCacheInfoFunction),
 
         // Standalone Table functions
         STANDALONE_TABLE_FUNCTION(LocalCacheArrayColumnFunction),
         STANDALONE_TABLE_FUNCTION(ClearWarningsFunction),
+        STANDALONE_TABLE_FUNCTION(AnalyzeFunction),
+        STANDALONE_TABLE_FUNCTION(CreateMaterializedViewFunction),
+        STANDALONE_TABLE_FUNCTION(InternalCreateMaterializedViewFunction),
+        STANDALONE_TABLE_FUNCTION(DropMaterializedViewFunction),
+        STANDALONE_TABLE_FUNCTION(InternalDropMaterializedViewFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphNativeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphCypherFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectedGraphFunction),
@@ -18,8 +18,8 @@ namespace function {
 template<typename T>
 class AWSPPathsEdgeCompute : public EdgeCompute {
 public:
-    explicit AWSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager)
-        : bfsGraphManager{bfsGraphManager} {
+    AWSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : bfsGraphManager{bfsGraphManager}, buckets{buckets} {
         block = bfsGraphManager->getCurrentGraph()->addNewBlock();
     }
 
@@ -36,18 +36,31 @@ public:
             }
             if (bfsGraphManager->getCurrentGraph()->tryAddParentWithWeight(boundNodeID, edgeID,
                     nbrNodeID, fwdEdge, static_cast<double>(weight), block)) {
-                result.push_back(nbrNodeID);
+                if (!defer(nbrNodeID)) {
+                    result.push_back(nbrNodeID);
+                }
             }
         });
         return result;
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraphManager);
+        return std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraphManager, buckets);
+    }
+
+private:
+    // Keep the node for a later bucket if delta-stepping reached it beyond the current bucket.
+    bool defer(nodeID_t nodeID) {
+        if (buckets == nullptr) {
+            return false;
+        }
+        auto cost = bfsGraphManager->getCurrentGraph()->getParentListHead(nodeID)->getCost();
+        return buckets->deferIfBeyondCurrentBucket(nodeID, cost);
     }
 
 private:
     BFSGraphManager* bfsGraphManager;
+    DeltaSteppingBuckets* buckets;
     ObjectBlock<ParentList>* block = nullptr;
 };
 
@@ -156,8 +169,11 @@ private:
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(AllWeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraph.get());
-                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph));
+                auto bfsGraphPtr = bfsGraph.get();
+                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph),
+                    DeltaSteppingBuckets::getBucketWidth(bindData, *clientContext));
+                auto edgeCompute = std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraphPtr,
+                    auxiliaryState->getDeltaSteppingBuckets());
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
@@ -0,0 +1,56 @@
+#include "function/gds/delta_stepping_buckets.h"
+
+#include <limits>
+
+#include "function/gds/rec_joins.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+double DeltaSteppingBuckets::getBucketWidth(const RJBindData& bindData,
+    const main::ClientContext& context) {
+    if (bindData.hasExplicitUpperBound) {
+        return 0;
+    }
+    return context.getClientConfig()->wspBucketWidth;
+}
+
+bool DeltaSteppingBuckets::deferIfBeyondCurrentBucket(nodeID_t nodeID, double cost) {
+    auto bucketIdx = getBucketIdx(cost);
+    if (bucketIdx <= curBucketIdx) {
+        return false;
+    }
+    std::unique_lock lck{mtx};
+    buckets[bucketIdx].emplace_back(nodeID, cost);
+    return true;
+}
+
+std::vector<nodeID_t> DeltaSteppingBuckets::popNextBucket() {
+    std::vector<nodeID_t> result;
+    while (result.empty() && !buckets.empty()) {
+        auto it = buckets.begin();
+        curBucketIdx = it->first;
+        for (auto& [nodeID, cost] : it->second) {
+            // A node whose cost improved was added again with the lower cost or already relaxed.
+            if (getCost(nodeID) == cost) {
+                result.push_back(nodeID);
+            }
+        }
+        buckets.erase(it);
+    }
+    return result;
+}
+
+uint64_t DeltaSteppingBuckets::getBucketIdx(double cost) const {
+    auto bucketIdx = cost / bucketWidth;
+    if (bucketIdx >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return static_cast<uint64_t>(bucketIdx);
+}
+
+} // namespace function
+} // namespace kuzu
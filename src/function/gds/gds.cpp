@@ -7,6 +7,7 @@
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "function/table/bind_input.h"
+#include "graph/csr_graph.h"
 #include "graph/graph_entry_set.h"
 #include "graph/on_disk_graph.h"
 #include "parser/parser.h"
@@ -28,8 +29,7 @@ namespace kuzu {
 namespace function {
 
 void GDSFuncSharedState::setGraphNodeMask(std::unique_ptr<NodeOffsetMaskMap> maskMap) {
-    auto onDiskGraph = ku_dynamic_cast<OnDiskGraph*>(graph.get());
-    onDiskGraph->setNodeOffsetMask(maskMap.get());
+    graph->setNodeOffsetMask(maskMap.get());
     graphNodeMask = std::move(maskMap);
 }
 
@@ -138,6 +138,7 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context,
             throw BinderException(stringFormat("{} is not a REL table.", relInfo.tableName));
         }
     }
+    result.csrCache = entry.csrCache;
     return result;
 }
 
@@ -186,8 +187,15 @@ std::string GDSFunction::bindColumnName(const parser::YieldVariable& yieldVariab
 std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<GDSBindData>();
-    auto graph =
+    auto onDiskGraph =
         std::make_unique<OnDiskGraph>(input.context->clientContext, bindData->graphEntry.copy());
+    std::unique_ptr<Graph> graph;
+    if (bindData->graphEntry.csrCache != nullptr) {
+        graph = std::make_unique<CSRGraph>(input.context, bindData->graphEntry.csrCache,
+            std::move(onDiskGraph));
+    } else {
+        graph = std::move(onDiskGraph);
+    }
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
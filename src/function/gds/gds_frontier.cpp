@@ -215,6 +215,7 @@ void FrontierPair::beginNewIteration() {
     std::unique_lock<std::mutex> lck{mtx};
     curIter++;
     hasActiveNodesForNextIter_.store(false);
+    numActiveNodesForCurrentIter = numActiveNodesForNextIter.exchange(0);
     beginNewIterationInternalNoLock();
 }
 
@@ -322,6 +323,40 @@ std::unordered_set<offset_t> SPFrontierPair::getActiveNodesOnCurrentFrontier() {
     return result;
 }
 
+iteration_t SPFrontierPair::getIteration(nodeID_t nodeID) {
+    auto frontier = getFrontier();
+    frontier->pinTableID(nodeID.tableID);
+    return frontier->getIteration(nodeID.offset);
+}
+
+std::vector<nodeID_t> SPFrontierPair::getNodesVisitedAtIter(iteration_t iter) {
+    std::vector<nodeID_t> result;
+    switch (state) {
+    case GDSDensityState::SPARSE: {
+        for (auto& [tableID, map] : sparseFrontier->sparseObjects.getData()) {
+            for (auto [offset, nodeIter] : map) {
+                if (nodeIter == iter) {
+                    result.push_back({offset, tableID});
+                }
+            }
+        }
+    } break;
+    case GDSDensityState::DENSE: {
+        for (auto& [tableID, maxOffset] : denseFrontier->nodeMaxOffsetMap) {
+            denseFrontier->pinTableID(tableID);
+            for (auto offset = 0u; offset < maxOffset; ++offset) {
+                if (denseFrontier->getIteration(offset) == iter) {
+                    result.push_back({offset, tableID});
+                }
+            }
+        }
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return result;
+}
+
 void SPFrontierPair::switchToDense(ExecutionContext* context, graph::Graph* graph) {
     KU_ASSERT(state == GDSDensityState::SPARSE);
     state = GDSDensityState::DENSE;
@@ -388,6 +423,64 @@ void DenseSparseDynamicFrontierPair::switchToDense(ExecutionContext* context, Gr
     }
 }
 
+// Moves the nodes active on the next frontier to iteration 0 and drops all other nodes.
+class DenseFrontierResetIterationsVertexCompute : public VertexCompute {
+public:
+    DenseFrontierResetIterationsVertexCompute(DenseFrontier& curFrontier,
+        DenseFrontier& nextFrontier, iteration_t activeIter)
+        : curFrontier{curFrontier}, nextFrontier{nextFrontier}, activeIter{activeIter} {}
+
+    bool beginOnTable(table_id_t tableID) override {
+        curFrontier.pinTableID(tableID);
+        nextFrontier.pinTableID(tableID);
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            curFrontier.addNode(i, FRONTIER_UNVISITED);
+            auto active = nextFrontier.getIteration(i) == activeIter;
+            nextFrontier.addNode(i, active ? FRONTIER_INITIAL_VISITED : FRONTIER_UNVISITED);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<DenseFrontierResetIterationsVertexCompute>(curFrontier,
+            nextFrontier, activeIter);
+    }
+
+private:
+    DenseFrontier& curFrontier;
+    DenseFrontier& nextFrontier;
+    iteration_t activeIter;
+};
+
+void DenseSparseDynamicFrontierPair::resetIterations(ExecutionContext* context, Graph* graph) {
+    std::unique_lock<std::mutex> lck{mtx};
+    switch (state) {
+    case GDSDensityState::SPARSE: {
+        for (auto& [tableID, _] : curSparseFrontier->sparseObjects.getData()) {
+            curSparseFrontier->sparseObjects.getMap(tableID)->clear();
+        }
+        for (auto& [tableID, _] : nextSparseFrontier->sparseObjects.getData()) {
+            auto map = nextSparseFrontier->sparseObjects.getMap(tableID);
+            std::erase_if(*map, [&](const auto& entry) { return entry.second != curIter; });
+            for (auto& entry : *map) {
+                entry.second = FRONTIER_INITIAL_VISITED;
+            }
+        }
+    } break;
+    case GDSDensityState::DENSE: {
+        auto vc = DenseFrontierResetIterationsVertexCompute(*curDenseFrontier, *nextDenseFrontier,
+            curIter);
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, vc);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    curIter = FRONTIER_INITIAL_VISITED;
+}
+
 DenseFrontierPair::DenseFrontierPair(std::unique_ptr<DenseFrontier> curDenseFrontier,
     std::unique_ptr<DenseFrontier> nextDenseFrontier)
     : curDenseFrontier{std::move(curDenseFrontier)},
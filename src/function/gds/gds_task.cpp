@@ -39,6 +39,10 @@ oid_t FrontierTaskInfo::getRelTableID() const {
 }
 
 void FrontierTask::run() {
+    if (info.bottomUp) {
+        runBottomUp();
+        return;
+    }
     FrontierMorsel morsel;
     auto numActiveNodes = 0u;
     auto graph = info.graph;
@@ -81,6 +85,40 @@ void FrontierTask::run() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
+        sharedState->frontierPair.setActiveNodesForNextIter();
+    }
+}
+
+void FrontierTask::runBottomUp() {
+    FrontierMorsel morsel;
+    auto numActiveNodes = 0u;
+    auto graph = info.graph;
+    // Unvisited nodes are in the nbr table and scan their edges towards the bound table.
+    auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
+        info.getBoundTableID(), info.propertiesToScan);
+    auto ec = info.edgeCompute.copy();
+    auto unvisitedTableID = info.getNbrTableID();
+    auto isFwd = info.direction == ExtendDirection::FWD;
+    while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+        for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
+            if (sharedState->frontierPair.getNextFrontierValue(offset) != FRONTIER_UNVISITED) {
+                continue;
+            }
+            nodeID_t nodeID = {offset, unvisitedTableID};
+            auto edges = isFwd ? graph->scanBwd(nodeID, *scanState) :
+                                 graph->scanFwd(nodeID, *scanState);
+            for (auto chunk : edges) {
+                if (ec->bottomUpCompute(nodeID, chunk, isFwd)) {
+                    sharedState->frontierPair.addNodeToNextFrontier(offset);
+                    numActiveNodes++;
+                    break;
+                }
+            }
+        }
+    }
+    if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
@@ -117,6 +155,7 @@ void FrontierTask::runSparse() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
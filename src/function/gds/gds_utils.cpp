@@ -1,9 +1,11 @@
 #include "function/gds/gds_utils.h"
 
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/interrupt.h"
 #include "common/task_system/task_scheduler.h"
+#include "function/gds/delta_stepping_buckets.h"
 #include "function/gds/gds_task.h"
 #include "graph/graph.h"
 #include "graph/graph_entry.h"
@@ -21,25 +23,28 @@ namespace function {
 
 static std::shared_ptr<FrontierTask> getFrontierTask(const main::ClientContext* context,
     const GraphRelInfo& relInfo, Graph* graph, ExtendDirection extendDirection,
-    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan) {
+    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan,
+    bool bottomUp) {
     auto info = FrontierTaskInfo(relInfo.srcTableID, relInfo.dstTableID, relInfo.relGroupEntry,
         graph, extendDirection, *computeState.edgeCompute, std::move(propertiesToScan));
+    info.bottomUp = bottomUp;
     computeState.beginFrontierCompute(info.getBoundTableID(), info.getNbrTableID());
     auto numThreads = context->getMaxNumThreadForExec();
     auto sharedState =
         std::make_shared<FrontierTaskSharedState>(numThreads, *computeState.frontierPair);
-    auto maxOffset =
-        graph->getMaxOffset(transaction::Transaction::Get(*context), info.getBoundTableID());
+    // Bottom-up tasks iterate over the unvisited nodes of the nbr table.
+    auto morselTableID = bottomUp ? info.getNbrTableID() : info.getBoundTableID();
+    auto maxOffset = graph->getMaxOffset(transaction::Transaction::Get(*context), morselTableID);
     sharedState->morselDispatcher.init(maxOffset);
     return std::make_shared<FrontierTask>(numThreads, info, sharedState);
 }
 
 static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo& relInfo,
     Graph* graph, ExtendDirection extendDirection, const GDSComputeState& computeState,
-    std::vector<std::string> propertiesToScan) {
+    std::vector<std::string> propertiesToScan, bool bottomUp) {
     auto clientContext = context->clientContext;
     auto task = getFrontierTask(clientContext, relInfo, graph, extendDirection, computeState,
-        std::move(propertiesToScan));
+        std::move(propertiesToScan), bottomUp);
     if (computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
         task->runSparse();
         return;
@@ -59,7 +64,7 @@ static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo&
 
 static void runOneIteration(ExecutionContext* context, Graph* graph,
     ExtendDirection extendDirection, const GDSComputeState& compState,
-    const std::vector<std::string>& propertiesToScan) {
+    const std::vector<std::string>& propertiesToScan, bool bottomUp = false) {
     for (auto info : graph->getGraphEntry()->nodeInfos) {
         for (const auto& relInfo : graph->getRelInfos(info.entry->getTableID())) {
             if (context->clientContext->interrupted()) {
@@ -68,17 +73,17 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
             switch (extendDirection) {
             case ExtendDirection::FWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, bottomUp);
             } break;
             case ExtendDirection::BWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, bottomUp);
             } break;
             case ExtendDirection::BOTH: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, bottomUp);
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, bottomUp);
             } break;
             default:
                 KU_UNREACHABLE;
@@ -103,17 +108,98 @@ void GDSUtils::runFTSEdgeCompute(ExecutionContext* context, GDSComputeState& com
     runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
 }
 
+void GDSUtils::runOneIterationEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection,
+    const std::vector<std::string>& propertiesToScan) {
+    compState.frontierPair->beginNewIteration();
+    runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+}
+
+// Direction-optimizing traversal (Beamer et al.): once the frontier holds more than
+// 1/TOP_DOWN_TO_BOTTOM_UP_FACTOR of the nodes, unvisited nodes search for a parent in the frontier
+// instead of the frontier expanding all its edges. Traversal goes back to top-down once the
+// frontier shrinks below 1/BOTTOM_UP_TO_TOP_DOWN_FACTOR of the nodes. Node counts stand in for the
+// edge counts of the original heuristic.
+static constexpr uint64_t TOP_DOWN_TO_BOTTOM_UP_FACTOR = 14;
+static constexpr uint64_t BOTTOM_UP_TO_TOP_DOWN_FACTOR = 24;
+
+// Bottom-up iterations scan edges in the direction opposite to the traversal, so every rel table
+// must store both directions.
+static bool canRunBottomUp(Graph* graph, const GDSComputeState& compState) {
+    if (!compState.edgeCompute->supportsBottomUp()) {
+        return false;
+    }
+    for (const auto tableID : graph->getNodeTableIDs()) {
+        for (const auto& relInfo : graph->getRelInfos(tableID)) {
+            auto& relGroupEntry = relInfo.relGroupEntry->constCast<RelGroupCatalogEntry>();
+            if (relGroupEntry.getStorageDirection() != ExtendDirection::BOTH) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Delta-stepping: relax the nodes of the current bucket until no node is left in it, then move on
+// to the next non-empty bucket. The number of iterations over all buckets is not bounded by the
+// number of hops, so the iteration count is restarted before it overflows iteration_t.
+static void runDeltaSteppingEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection, DeltaSteppingBuckets& buckets,
+    const std::vector<std::string>& propertiesToScan) {
+    auto frontierPair = compState.frontierPair.get();
+    while (true) {
+        while (frontierPair->continueNextIter(FRONTIER_UNVISITED)) {
+            if (frontierPair->getCurrentIter() >= FRONTIER_UNVISITED - 1) {
+                frontierPair->resetIterations(context, graph);
+            }
+            frontierPair->beginNewIteration();
+            runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+            if (frontierPair->needSwitchToDense(
+                    context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
+                compState.switchToDense(context, graph);
+            }
+        }
+        auto nodeIDs = buckets.popNextBucket();
+        if (nodeIDs.empty()) {
+            break;
+        }
+        for (auto nodeID : nodeIDs) {
+            frontierPair->pinNextFrontier(nodeID.tableID);
+            frontierPair->addNodeToNextFrontier(nodeID);
+        }
+        frontierPair->setActiveNodesForNextIter();
+    }
+}
+
 void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration,
     NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
+    auto buckets = compState.auxiliaryState->getDeltaSteppingBuckets();
+    if (buckets != nullptr) {
+        // Only used without an upper bound in the pattern, see DeltaSteppingBuckets.
+        runDeltaSteppingEdgeCompute(context, compState, graph, extendDirection, *buckets,
+            propertiesToScan);
+        return;
+    }
     auto frontierPair = compState.frontierPair.get();
     compState.edgeCompute->resetSingleThreadState();
+    auto canBottomUp = canRunBottomUp(graph, compState);
+    offset_t numNodes = 0;
+    if (canBottomUp) {
+        numNodes = graph->getNumNodes(transaction::Transaction::Get(*context->clientContext));
+    }
+    auto bottomUp = false;
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
             break;
         }
-        runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+        if (canBottomUp && frontierPair->getState() == GDSDensityState::DENSE) {
+            auto frontierSize = frontierPair->getNumActiveNodesForCurrentIter();
+            bottomUp = bottomUp ? frontierSize * BOTTOM_UP_TO_TOP_DOWN_FACTOR >= numNodes :
+                                  frontierSize * TOP_DOWN_TO_BOTTOM_UP_FACTOR > numNodes;
+        }
+        runOneIteration(context, graph, extendDirection, compState, propertiesToScan, bottomUp);
         if (frontierPair->needSwitchToDense(
                 context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
             compState.switchToDense(context, graph);
@@ -121,6 +207,68 @@ void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSCompute
     }
 }
 
+static ExtendDirection getReverseDirection(ExtendDirection extendDirection) {
+    switch (extendDirection) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    case ExtendDirection::BOTH:
+        return ExtendDirection::BOTH;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+// Expand the search of compState by one level and return a newly visited node that the other
+// search has already visited, if any.
+static std::optional<nodeID_t> expandOneLevel(ExecutionContext* context, Graph* graph,
+    ExtendDirection extendDirection, const GDSComputeState& compState,
+    SPFrontierPair& otherFrontierPair, const std::vector<std::string>& propertiesToScan) {
+    auto frontierPair = compState.frontierPair->ptrCast<SPFrontierPair>();
+    frontierPair->beginNewIteration();
+    runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+    if (frontierPair->needSwitchToDense(
+            context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
+        compState.switchToDense(context, graph);
+    }
+    for (auto nodeID : frontierPair->getNodesVisitedAtIter(frontierPair->getCurrentIter())) {
+        if (otherFrontierPair.getIteration(nodeID) != FRONTIER_UNVISITED) {
+            return nodeID;
+        }
+    }
+    return std::nullopt;
+}
+
+// Both searches always expand whole levels. If no node has been reached by both searches after
+// i levels from the source and j levels from the destination, the shortest path is longer than
+// i + j. So the first node reached by both searches lies on a shortest path.
+std::optional<nodeID_t> GDSUtils::runBidirectionalRecursiveJoinEdgeCompute(
+    ExecutionContext* context, GDSComputeState& srcState, GDSComputeState& dstState, Graph* graph,
+    ExtendDirection extendDirection, uint64_t maxIteration,
+    const std::vector<std::string>& propertiesToScan) {
+    auto srcFrontierPair = srcState.frontierPair->ptrCast<SPFrontierPair>();
+    auto dstFrontierPair = dstState.frontierPair->ptrCast<SPFrontierPair>();
+    while (srcFrontierPair->getCurrentIter() + dstFrontierPair->getCurrentIter() < maxIteration &&
+           srcFrontierPair->continueNextIter(maxIteration) &&
+           dstFrontierPair->continueNextIter(maxIteration)) {
+        // Expand the side with fewer nodes to visit.
+        std::optional<nodeID_t> meetNodeID;
+        if (srcFrontierPair->getNumActiveNodesForNextIter() <=
+            dstFrontierPair->getNumActiveNodesForNextIter()) {
+            meetNodeID = expandOneLevel(context, graph, extendDirection, srcState,
+                *dstFrontierPair, propertiesToScan);
+        } else {
+            meetNodeID = expandOneLevel(context, graph, getReverseDirection(extendDirection),
+                dstState, *srcFrontierPair, propertiesToScan);
+        }
+        if (meetNodeID.has_value()) {
+            return meetNodeID;
+        }
+    }
+    return std::nullopt;
+}
+
 static void runVertexComputeInternal(const TableCatalogEntry* currentEntry,
     GDSDensityState densityState, const Graph* graph, std::shared_ptr<VertexComputeTask> task,
     ExecutionContext* context) {
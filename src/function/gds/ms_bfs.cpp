@@ -0,0 +1,296 @@
+#include "function/gds/ms_bfs.h"
+
+#include <bit>
+
+#include "binder/expression/node_expression.h"
+#include "function/gds/gds_utils.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+using source_bits_t = std::atomic<uint64_t>;
+
+// Per node bitsets of the sources that reached the node (seen), that reached the node in the
+// previous iteration (cur) and that reach the node in the current iteration (next). Bit i stands
+// for the i-th source of the batch.
+class MSBFSAuxiliaryState : public GDSAuxiliaryState {
+public:
+    MSBFSAuxiliaryState(const table_id_map_t<offset_t>& maxOffsetMap, storage::MemoryManager* mm)
+        : curBits{std::make_unique<GDSDenseObjectManager<source_bits_t>>()},
+          nextBits{std::make_unique<GDSDenseObjectManager<source_bits_t>>()} {
+        for (auto& [tableID, maxOffset] : maxOffsetMap) {
+            seenBits.allocate(tableID, maxOffset, mm);
+            curBits->allocate(tableID, maxOffset, mm);
+            nextBits->allocate(tableID, maxOffset, mm);
+        }
+    }
+
+    const std::vector<nodeID_t>& getSources() const { return sources; }
+    source_bits_t* getSeenBits(table_id_t tableID) const { return seenBits.getData(tableID); }
+    source_bits_t* getCurBits(table_id_t tableID) const { return curBits->getData(tableID); }
+    source_bits_t* getNextBits(table_id_t tableID) const { return nextBits->getData(tableID); }
+
+    // Clear sources. Bitsets must be zeroed by the caller.
+    void resetSources() { sources.clear(); }
+
+    void initSource(nodeID_t sourceNodeID) override {
+        KU_ASSERT(sources.size() < MultiSourceBFS::MAX_NUM_SOURCES);
+        auto bit = (uint64_t)1 << sources.size();
+        sources.push_back(sourceNodeID);
+        seenBits.getData(sourceNodeID.tableID)[sourceNodeID.offset].fetch_or(bit);
+        curBits->getData(sourceNodeID.tableID)[sourceNodeID.offset].fetch_or(bit);
+    }
+
+    void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
+        pinnedCurBits = curBits->getData(fromTableID);
+        pinnedSeenBits = seenBits.getData(toTableID);
+        pinnedNextBits = nextBits->getData(toTableID);
+    }
+
+    void switchToDense(ExecutionContext*, Graph*) override {}
+
+    uint64_t getPinnedCurBits(offset_t offset) const {
+        return pinnedCurBits[offset].load(std::memory_order_relaxed);
+    }
+
+    // Marks the node as reached by the given sources. Returns true if one of them had not reached
+    // the node before.
+    bool visit(offset_t offset, uint64_t bits) {
+        auto newBits = bits & ~pinnedSeenBits[offset].load(std::memory_order_relaxed);
+        if (newBits == 0) {
+            return false;
+        }
+        newBits &= ~pinnedSeenBits[offset].fetch_or(newBits, std::memory_order_relaxed);
+        if (newBits == 0) {
+            return false;
+        }
+        pinnedNextBits[offset].fetch_or(newBits, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Bits of the current iteration become the bits of the previous one.
+    void finishIteration() { std::swap(curBits, nextBits); }
+
+private:
+    std::vector<nodeID_t> sources;
+    GDSDenseObjectManager<source_bits_t> seenBits;
+    std::unique_ptr<GDSDenseObjectManager<source_bits_t>> curBits;
+    std::unique_ptr<GDSDenseObjectManager<source_bits_t>> nextBits;
+    source_bits_t* pinnedCurBits = nullptr;
+    source_bits_t* pinnedSeenBits = nullptr;
+    source_bits_t* pinnedNextBits = nullptr;
+};
+
+class MSBFSEdgeCompute : public EdgeCompute {
+public:
+    explicit MSBFSEdgeCompute(MSBFSAuxiliaryState* auxiliaryState)
+        : auxiliaryState{auxiliaryState} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, NbrScanState::Chunk& resultChunk,
+        bool) override {
+        std::vector<nodeID_t> activeNodes;
+        auto bits = auxiliaryState->getPinnedCurBits(boundNodeID.offset);
+        resultChunk.forEach([&](auto neighbors, auto, auto i) {
+            auto nbrNode = neighbors[i];
+            if (auxiliaryState->visit(nbrNode.offset, bits)) {
+                activeNodes.push_back(nbrNode);
+            }
+        });
+        return activeNodes;
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<MSBFSEdgeCompute>(auxiliaryState);
+    }
+
+private:
+    MSBFSAuxiliaryState* auxiliaryState;
+};
+
+class MSBFSResetVertexCompute : public VertexCompute {
+public:
+    explicit MSBFSResetVertexCompute(const MSBFSAuxiliaryState& auxiliaryState)
+        : auxiliaryState{auxiliaryState} {}
+
+    bool beginOnTable(table_id_t tableID) override {
+        seenBits = auxiliaryState.getSeenBits(tableID);
+        curBits = auxiliaryState.getCurBits(tableID);
+        nextBits = auxiliaryState.getNextBits(tableID);
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            seenBits[i].store(0, std::memory_order_relaxed);
+            curBits[i].store(0, std::memory_order_relaxed);
+            nextBits[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto result = std::make_unique<MSBFSResetVertexCompute>(auxiliaryState);
+        result->seenBits = seenBits;
+        result->curBits = curBits;
+        result->nextBits = nextBits;
+        return result;
+    }
+
+private:
+    const MSBFSAuxiliaryState& auxiliaryState;
+    source_bits_t* seenBits = nullptr;
+    source_bits_t* curBits = nullptr;
+    source_bits_t* nextBits = nullptr;
+};
+
+// Writes (source, destination, length) for every source that reached a node in the current
+// iteration and clears the bits of the previous iteration.
+class MSBFSOutputVertexCompute : public VertexCompute {
+public:
+    MSBFSOutputVertexCompute(storage::MemoryManager* mm, RecursiveExtendSharedState* sharedState,
+        const MSBFSAuxiliaryState& auxiliaryState, const table_id_set_t& outputTableIDs,
+        uint16_t length)
+        : mm{mm}, sharedState{sharedState}, auxiliaryState{auxiliaryState},
+          outputTableIDs{outputTableIDs}, length{length} {
+        localFT = sharedState->factorizedTablePool.claimLocalTable(mm);
+        srcNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        dstNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        lengthVector = createVector(LogicalType::UINT16());
+        lengthVector->setValue<uint16_t>(0, length);
+    }
+    ~MSBFSOutputVertexCompute() override {
+        sharedState->factorizedTablePool.returnLocalTable(localFT);
+    }
+
+    bool beginOnTable(table_id_t tableID) override {
+        curBits = auxiliaryState.getCurBits(tableID);
+        nextBits = auxiliaryState.getNextBits(tableID);
+        // Nbr node table IDs might be different from graph node table IDs. Bits must be cleared
+        // on all tables though.
+        isOutputTable = outputTableIDs.contains(tableID);
+        outputMask = nullptr;
+        auto outputNodeMask = sharedState->getOutputNodeMaskMap();
+        if (outputNodeMask != nullptr && outputNodeMask->containsTableID(tableID)) {
+            auto mask = outputNodeMask->getOffsetMask(tableID);
+            if (mask->isEnabled()) {
+                outputMask = mask;
+            }
+        }
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto& sources = auxiliaryState.getSources();
+        for (auto i = startOffset; i < endOffset; ++i) {
+            curBits[i].store(0, std::memory_order_relaxed);
+            if (!isOutputTable) {
+                continue;
+            }
+            auto bits = nextBits[i].load(std::memory_order_relaxed);
+            if (bits == 0 || (outputMask != nullptr && !outputMask->isMasked(i))) {
+                continue;
+            }
+            dstNodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            // A source is seen at level 0, so no source reaches itself here.
+            for (; bits != 0; bits &= bits - 1) {
+                if (sharedState->exceedLimit()) {
+                    return;
+                }
+                srcNodeIDVector->setValue<nodeID_t>(0, sources[std::countr_zero(bits)]);
+                localFT->append(vectors);
+                if (sharedState->counter != nullptr) {
+                    sharedState->counter->increase(1);
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto result = std::make_unique<MSBFSOutputVertexCompute>(mm, sharedState, auxiliaryState,
+            outputTableIDs, length);
+        result->curBits = curBits;
+        result->nextBits = nextBits;
+        result->isOutputTable = isOutputTable;
+        result->outputMask = outputMask;
+        return result;
+    }
+
+private:
+    std::unique_ptr<ValueVector> createVector(const LogicalType& type) {
+        auto vector = std::make_unique<ValueVector>(type.copy(), mm);
+        vector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(vector.get());
+        return vector;
+    }
+
+private:
+    storage::MemoryManager* mm;
+    RecursiveExtendSharedState* sharedState;
+    const MSBFSAuxiliaryState& auxiliaryState;
+    const table_id_set_t& outputTableIDs;
+    uint16_t length;
+    FactorizedTable* localFT;
+    std::vector<ValueVector*> vectors;
+    std::unique_ptr<ValueVector> srcNodeIDVector;
+    std::unique_ptr<ValueVector> dstNodeIDVector;
+    std::unique_ptr<ValueVector> lengthVector;
+
+    source_bits_t* curBits = nullptr;
+    source_bits_t* nextBits = nullptr;
+    bool isOutputTable = false;
+    SemiMask* outputMask = nullptr;
+};
+
+MultiSourceBFS::MultiSourceBFS(ExecutionContext* context, const RJBindData& bindData,
+    RecursiveExtendSharedState* sharedState)
+    : context{context}, sharedState{sharedState}, extendDirection{bindData.extendDirection},
+      upperBound{bindData.upperBound},
+      outputTableIDs{bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet()} {
+    auto graph = sharedState->graph.get();
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto mm = storage::MemoryManager::Get(*context->clientContext);
+    auto frontierPair =
+        std::make_unique<DenseFrontierPair>(DenseFrontier::getUnvisitedFrontier(context, graph),
+            DenseFrontier::getUnvisitedFrontier(context, graph));
+    auto auxState = std::make_unique<MSBFSAuxiliaryState>(graph->getMaxOffsetMap(transaction), mm);
+    auxiliaryState = auxState.get();
+    auto edgeCompute = std::make_unique<MSBFSEdgeCompute>(auxiliaryState);
+    computeState = std::make_unique<GDSComputeState>(std::move(frontierPair),
+        std::move(edgeCompute), std::move(auxState));
+}
+
+void MultiSourceBFS::run(const std::vector<nodeID_t>& sourceNodeIDs) {
+    KU_ASSERT(!sourceNodeIDs.empty() && sourceNodeIDs.size() <= MAX_NUM_SOURCES);
+    auto graph = sharedState->graph.get();
+    auto mm = storage::MemoryManager::Get(*context->clientContext);
+    auto frontierPair = computeState->frontierPair->ptrCast<DenseFrontierPair>();
+    frontierPair->resetValue(context, graph, FRONTIER_UNVISITED);
+    frontierPair->resetCurrentIter();
+    auto resetVertexCompute = MSBFSResetVertexCompute(*auxiliaryState);
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, resetVertexCompute);
+    auxiliaryState->resetSources();
+    for (auto& sourceNodeID : sourceNodeIDs) {
+        computeState->initSource(sourceNodeID);
+    }
+    while (frontierPair->continueNextIter(upperBound)) {
+        GDSUtils::runOneIterationEdgeCompute(context, *computeState, graph, extendDirection,
+            {} /* propertiesToScan */);
+        auto outputVertexCompute = MSBFSOutputVertexCompute(mm, sharedState, *auxiliaryState,
+            outputTableIDs, frontierPair->getCurrentIter());
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, outputVertexCompute);
+        auxiliaryState->finishIteration();
+        if (sharedState->exceedLimit()) {
+            break;
+        }
+    }
+}
+
+} // namespace function
+} // namespace kuzu
@@ -9,6 +9,7 @@ RJBindData::RJBindData(const RJBindData& other) {
     nodeOutput = other.nodeOutput;
     lowerBound = other.lowerBound;
     upperBound = other.upperBound;
+    hasExplicitUpperBound = other.hasExplicitUpperBound;
     semantic = other.semantic;
     extendDirection = other.extendDirection;
     flipPath = other.flipPath;
@@ -75,6 +75,17 @@ public:
         return activeNodes;
     }
 
+    bool supportsBottomUp() const override { return true; }
+
+    bool bottomUpCompute(nodeID_t, NbrScanState::Chunk& resultChunk, bool) override {
+        auto reached = false;
+        resultChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) {
+            reached = frontierPair->isActiveOnCurrentFrontier(neighbors[i].offset);
+            return !reached;
+        });
+        return reached;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPDestinationsEdgeCompute>(frontierPair);
     }
@@ -94,6 +105,19 @@ public:
         return columns;
     }
 
+    bool supportsBidirectionalSearch() const override { return true; }
+
+    void mergeBidirectionalSearch(GDSComputeState& srcState, GDSComputeState& dstState,
+        nodeID_t meetNodeID, nodeID_t dstNodeID) const override {
+        auto srcFrontierPair = srcState.frontierPair->ptrCast<SPFrontierPair>();
+        auto dstFrontierPair = dstState.frontierPair->ptrCast<SPFrontierPair>();
+        iteration_t length =
+            srcFrontierPair->getIteration(meetNodeID) + dstFrontierPair->getIteration(meetNodeID);
+        auto frontier = srcFrontierPair->getFrontier();
+        frontier->pinTableID(dstNodeID.tableID);
+        frontier->addNode(dstNodeID, length);
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<SingleSPDestinationsAlgorithm>(*this);
     }
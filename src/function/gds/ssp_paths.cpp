@@ -39,6 +39,27 @@ public:
         return activeNodes;
     }
 
+    bool supportsBottomUp() const override { return true; }
+
+    bool bottomUpCompute(nodeID_t nodeID, graph::NbrScanState::Chunk& resultChunk,
+        bool isFwd) override {
+        auto reached = false;
+        resultChunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+            auto parentNodeID = neighbors[i];
+            if (reached || !frontierPair->isActiveOnCurrentFrontier(parentNodeID.offset)) {
+                return;
+            }
+            if (!block->hasSpace()) {
+                block = bfsGraphManager->getCurrentGraph()->addNewBlock();
+            }
+            auto edgeID = propertyVectors[0]->template getValue<nodeID_t>(i);
+            bfsGraphManager->getCurrentGraph()->addSingleParent(frontierPair->getCurrentIter(),
+                parentNodeID, edgeID, nodeID, isFwd, block);
+            reached = true;
+        });
+        return reached;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPPathsEdgeCompute>(frontierPair, bfsGraphManager);
     }
@@ -67,11 +88,41 @@ public:
         return columns;
     }
 
+    bool supportsBidirectionalSearch() const override { return true; }
+
+    void mergeBidirectionalSearch(GDSComputeState& srcState, GDSComputeState& dstState,
+        nodeID_t meetNodeID, nodeID_t dstNodeID) const override {
+        auto srcGraph = getBFSGraph(srcState);
+        auto dstGraph = getBFSGraph(dstState);
+        auto iter = srcState.frontierPair->ptrCast<SPFrontierPair>()->getIteration(meetNodeID);
+        auto block = srcGraph->addNewBlock();
+        // Walk from the meeting node to the destination. A parent in the search from the
+        // destination is a child in the search from the source, so the edge direction flips.
+        auto nodeID = meetNodeID;
+        while (nodeID != dstNodeID) {
+            auto parent = dstGraph->getParentListHead(nodeID);
+            auto nextNodeID = parent->getNodeID();
+            if (!block->hasSpace()) {
+                block = srcGraph->addNewBlock();
+            }
+            srcGraph->pinTableID(nextNodeID.tableID);
+            srcGraph->addSingleParent(++iter, nodeID, parent->getEdgeID(), nextNodeID,
+                !parent->isFwdEdge(), block);
+            nodeID = nextNodeID;
+        }
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<SingleSPPathsAlgorithm>(*this);
     }
 
 private:
+    static BaseBFSGraph* getBFSGraph(GDSComputeState& computeState) {
+        return computeState.auxiliaryState->ptrCast<PathAuxiliaryState>()
+            ->getBFSGraphManager()
+            ->getCurrentGraph();
+    }
+
     std::unique_ptr<GDSComputeState> getComputeState(ExecutionContext* context, const RJBindData&,
         RecursiveExtendSharedState* sharedState) override {
         auto clientContext = context->clientContext;
@@ -91,9 +142,7 @@ private:
     std::unique_ptr<RJOutputWriter> getOutputWriter(ExecutionContext* context,
         const RJBindData& bindData, GDSComputeState& computeState, nodeID_t sourceNodeID,
         RecursiveExtendSharedState* sharedState) override {
-        auto bfsGraph = computeState.auxiliaryState->ptrCast<PathAuxiliaryState>()
-                            ->getBFSGraphManager()
-                            ->getCurrentGraph();
+        auto bfsGraph = getBFSGraph(computeState);
         auto writerInfo = bindData.getPathWriterInfo();
         writerInfo.pathNodeMask = sharedState->getPathNodeMaskMap();
         return std::make_unique<SPPathsOutputWriter>(context->clientContext,
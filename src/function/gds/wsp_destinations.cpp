@@ -1,7 +1,9 @@
 #include "binder/expression/node_expression.h"
+#include "function/gds/delta_stepping_buckets.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -183,7 +185,8 @@ private:
 template<typename T>
 class WSPDestinationsEdgeCompute : public EdgeCompute {
 public:
-    explicit WSPDestinationsEdgeCompute(CostsPair* costsPair) : costsPair{costsPair} {}
+    WSPDestinationsEdgeCompute(CostsPair* costsPair, DeltaSteppingBuckets* buckets)
+        : costsPair{costsPair}, buckets{buckets} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool) override {
@@ -193,7 +196,8 @@ public:
             auto weight = propertyVectors[0]->template getValue<T>(i);
             WeightUtils::checkWeight(WeightedSPDestinationsFunction::name, weight);
             if (costsPair->update(boundNodeID.offset, nbrNodeID.offset,
-                    static_cast<double>(weight))) {
+                    static_cast<double>(weight)) &&
+                !defer(boundNodeID, nbrNodeID, static_cast<double>(weight))) {
                 result.push_back(nbrNodeID);
             }
         });
@@ -201,17 +205,37 @@ public:
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair);
+        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair, buckets);
+    }
+
+private:
+    // Keep the nbr for a later bucket if delta-stepping reached it beyond the current bucket.
+    bool defer(nodeID_t boundNodeID, nodeID_t nbrNodeID, double weight) {
+        if (buckets == nullptr) {
+            return false;
+        }
+        auto cost = costsPair->getCurrentCosts()->getCost(boundNodeID.offset) + weight;
+        return buckets->deferIfBeyondCurrentBucket(nbrNodeID, cost);
     }
 
 private:
     CostsPair* costsPair;
+    DeltaSteppingBuckets* buckets;
 };
 
 class WSPDestinationsAuxiliaryState : public GDSAuxiliaryState {
 public:
-    explicit WSPDestinationsAuxiliaryState(std::unique_ptr<CostsPair> costsPair)
-        : costsPair{std::move(costsPair)} {}
+    // Run delta-stepping with the given bucket width if it is positive.
+    WSPDestinationsAuxiliaryState(std::unique_ptr<CostsPair> costsPair, double bucketWidth)
+        : costsPair{std::move(costsPair)} {
+        if (bucketWidth > 0) {
+            auto pair = this->costsPair.get();
+            buckets = std::make_unique<DeltaSteppingBuckets>(bucketWidth, [pair](nodeID_t nodeID) {
+                pair->pinCurTableID(nodeID.tableID);
+                return pair->getCurrentCosts()->getCost(nodeID.offset);
+            });
+        }
+    }
 
     Costs* getCosts() { return costsPair->getCurrentCosts(); }
 
@@ -229,8 +253,11 @@ public:
         costsPair->switchToDense(context);
     }
 
+    DeltaSteppingBuckets* getDeltaSteppingBuckets() override { return buckets.get(); }
+
 private:
     std::unique_ptr<CostsPair> costsPair;
+    std::unique_ptr<DeltaSteppingBuckets> buckets;
 };
 
 class WSPDestinationsOutputWriter : public RJOutputWriter {
@@ -309,11 +336,14 @@ private:
         auto costsPair = std::make_unique<CostsPair>(
             graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)));
         auto costPairPtr = costsPair.get();
-        auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair));
+        auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair),
+            DeltaSteppingBuckets::getBucketWidth(bindData, *clientContext));
+        auto buckets = auxiliaryState->getDeltaSteppingBuckets();
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPDestinationsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr);
+                auto edgeCompute =
+                    std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr, buckets);
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
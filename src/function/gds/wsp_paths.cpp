@@ -3,6 +3,7 @@
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -17,8 +18,8 @@ namespace function {
 template<typename T>
 class WSPPathsEdgeCompute : public EdgeCompute {
 public:
-    explicit WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager)
-        : bfsGraphManager{bfsGraphManager} {
+    WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : bfsGraphManager{bfsGraphManager}, buckets{buckets} {
         block = bfsGraphManager->getCurrentGraph()->addNewBlock();
     }
 
@@ -35,18 +36,31 @@ public:
             }
             if (bfsGraphManager->getCurrentGraph()->tryAddSingleParentWithWeight(boundNodeID,
                     edgeID, nbrNodeID, fwdEdge, static_cast<double>(weight), block)) {
-                result.push_back(nbrNodeID);
+                if (!defer(nbrNodeID)) {
+                    result.push_back(nbrNodeID);
+                }
             }
         });
         return result;
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager);
+        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager, buckets);
+    }
+
+private:
+    // Keep the node for a later bucket if delta-stepping reached it beyond the current bucket.
+    bool defer(nodeID_t nodeID) {
+        if (buckets == nullptr) {
+            return false;
+        }
+        auto cost = bfsGraphManager->getCurrentGraph()->getParentListHead(nodeID)->getCost();
+        return buckets->deferIfBeyondCurrentBucket(nodeID, cost);
     }
 
 private:
     BFSGraphManager* bfsGraphManager;
+    DeltaSteppingBuckets* buckets;
     ObjectBlock<ParentList>* block = nullptr;
 };
 
@@ -127,8 +141,11 @@ private:
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraph.get());
-                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph));
+                auto bfsGraphPtr = bfsGraph.get();
+                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph),
+                    DeltaSteppingBuckets::getBucketWidth(bindData, *clientContext));
+                auto edgeCompute = std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphPtr,
+                    auxiliaryState->getDeltaSteppingBuckets());
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
@@ -0,0 +1,188 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/constants.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "processor/execution_context.h"
+#include "storage/stats/column_histogram.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct AnalyzeBindData final : TableFuncBindData {
+    catalog::TableCatalogEntry* tableEntry;
+    // Columns whose type supports histograms.
+    std::vector<column_id_t> columnIDs;
+
+    AnalyzeBindData(catalog::TableCatalogEntry* tableEntry, std::vector<column_id_t> columnIDs)
+        : tableEntry{tableEntry}, columnIDs{std::move(columnIDs)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(tableEntry, columnIDs);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    std::vector<column_id_t> columnIDs;
+    for (auto& property : tableEntry->getProperties()) {
+        if (ColumnHistogram::isSupported(property.getType())) {
+            columnIDs.push_back(tableEntry->getColumnID(property.getName()));
+        }
+    }
+    return std::make_unique<AnalyzeBindData>(tableEntry, std::move(columnIDs));
+}
+
+struct AnalyzeSharedState final : public SimpleTableFuncSharedState {
+    AnalyzeSharedState(NodeTable& table, node_group_idx_t numNodeGroups,
+        std::vector<column_id_t> columnIDs, row_idx_t sampleStride)
+        : SimpleTableFuncSharedState{numNodeGroups, 1 /*maxMorselSize*/}, table{table},
+          columnIDs{std::move(columnIDs)}, sampleStride{sampleStride},
+          samples(this->columnIDs.size()), numValues(this->columnIDs.size(), 0) {}
+
+    void merge(std::vector<std::vector<double>>& localSamples,
+        const std::vector<uint64_t>& localNumValues) {
+        std::unique_lock lck{mtx};
+        for (auto i = 0u; i < samples.size(); i++) {
+            samples[i].insert(samples[i].end(), localSamples[i].begin(), localSamples[i].end());
+            numValues[i] += localNumValues[i];
+        }
+    }
+
+    std::mutex mtx;
+    NodeTable& table;
+    std::vector<column_id_t> columnIDs;
+    // Every sampleStride-th row of each node group is sampled.
+    row_idx_t sampleStride;
+    std::vector<std::vector<double>> samples;
+    // Number of non-null values of each column.
+    std::vector<uint64_t> numValues;
+};
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    const auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    const auto context = input.context->clientContext;
+    auto& table = StorageManager::Get(*context)
+                      ->getTable(bindData->tableEntry->getTableID())
+                      ->cast<NodeTable>();
+    const auto numRows = table.getNumTotalRows(transaction::Transaction::Get(*context));
+    const auto sampleStride =
+        std::max<row_idx_t>(1, numRows / HistogramConstants::ANALYZE_SAMPLE_SIZE);
+    return std::make_unique<AnalyzeSharedState>(table, table.getNumCommittedNodeGroups(),
+        bindData->columnIDs, sampleStride);
+}
+
+struct AnalyzeLocalState final : TableFuncLocalState {
+    AnalyzeLocalState(const main::ClientContext& context, NodeTable& table,
+        const std::vector<column_id_t>& columnIDs)
+        : dataChunk{static_cast<uint32_t>(columnIDs.size() + 1),
+              std::make_shared<DataChunkState>()} {
+        dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+        std::vector<ValueVector*> outputVectors;
+        for (auto i = 0u; i < columnIDs.size(); i++) {
+            dataChunk.insert(i + 1, std::make_shared<ValueVector>(
+                                        table.getColumn(columnIDs[i]).getDataType().copy()));
+            outputVectors.push_back(&dataChunk.getValueVectorMutable(i + 1));
+        }
+        scanState = std::make_unique<NodeTableScanState>(&dataChunk.getValueVectorMutable(0),
+            std::move(outputVectors), dataChunk.state);
+        scanState->source = TableScanSource::COMMITTED;
+        scanState->setToTable(transaction::Transaction::Get(context), &table, columnIDs, {});
+    }
+
+    DataChunk dataChunk;
+    std::unique_ptr<NodeTableScanState> scanState;
+};
+
+static std::unique_ptr<TableFuncLocalState> initLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    auto sharedState = input.sharedState.ptrCast<AnalyzeSharedState>();
+    return std::make_unique<AnalyzeLocalState>(*input.clientContext, sharedState->table,
+        sharedState->columnIDs);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto sharedState = input.sharedState->ptrCast<AnalyzeSharedState>();
+    const auto localState = input.localState->ptrCast<AnalyzeLocalState>();
+    const auto morsel = sharedState->getMorsel();
+    if (morsel.isInvalid()) {
+        return 0;
+    }
+    const auto transaction = transaction::Transaction::Get(*input.context->clientContext);
+    auto& table = sharedState->table;
+    auto& scanState = *localState->scanState;
+    const auto numColumns = scanState.outputVectors.size();
+    std::vector<std::vector<double>> samples(numColumns);
+    std::vector<uint64_t> numValues(numColumns, 0);
+    for (auto nodeGroupIdx = morsel.startOffset; nodeGroupIdx < morsel.endOffset;
+         nodeGroupIdx++) {
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        table.initScanState(transaction, scanState);
+        row_idx_t numRowsScanned = 0;
+        while (table.scan(transaction, scanState)) {
+            const auto& selVector = scanState.outState->getSelVector();
+            for (auto i = 0u; i < numColumns; i++) {
+                const auto& vector = *scanState.outputVectors[i];
+                auto rowIdx = numRowsScanned;
+                selVector.forEach([&](auto pos) {
+                    if (!vector.isNull(pos)) {
+                        numValues[i]++;
+                        if (rowIdx % sharedState->sampleStride == 0) {
+                            samples[i].push_back(ColumnHistogram::readValue(vector, pos));
+                        }
+                    }
+                    rowIdx++;
+                });
+            }
+            numRowsScanned += selVector.getSelSize();
+        }
+    }
+    sharedState->merge(samples, numValues);
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static void finalizeFunc(const processor::ExecutionContext* context,
+    TableFuncSharedState* sharedState) {
+    const auto analyzeSharedState = sharedState->ptrCast<AnalyzeSharedState>();
+    for (auto i = 0u; i < analyzeSharedState->columnIDs.size(); i++) {
+        auto histogram = ColumnHistogram::build(std::move(analyzeSharedState->samples[i]),
+            static_cast<double>(analyzeSharedState->numValues[i]),
+            HistogramConstants::NUM_BUCKETS, HistogramConstants::MAX_NUM_MOST_COMMON_VALUES);
+        analyzeSharedState->table.setHistogram(analyzeSharedState->columnIDs[i],
+            std::move(histogram));
+    }
+    // Histograms are not logged to the WAL. Like COPY, we checkpoint on commit to persist them.
+    transaction::Transaction::Get(*context->clientContext)->setForceCheckpoint();
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = initLocalState;
+    func->tableFunc = tableFunc;
+    func->finalizeFunc = finalizeFunc;
+    func->canParallelFunc = [] { return true; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,58 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+namespace kuzu {
+namespace function {
+
+struct CheckpointInfoBindData final : TableFuncBindData {
+    storage::CheckpointStats stats;
+
+    CheckpointInfoBindData(storage::CheckpointStats stats, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CheckpointInfoBindData>(stats, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 3);
+    const auto& stats = input.bindData->constPtrCast<CheckpointInfoBindData>()->stats;
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, stats.numCSRNodeGroupsSkipped);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, stats.numCSRRegionsCheckpointed);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, stats.numCSRBytesWritten);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto stats = storage::StorageManager::Get(*context)->getCheckpointStats();
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames = std::vector<std::string>{"num_csr_node_groups_skipped",
+        "num_csr_regions_checkpointed", "num_csr_bytes_written"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<CheckpointInfoBindData>(stats, columns);
+}
+
+function_set CheckpointInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
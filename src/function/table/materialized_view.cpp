@@ -0,0 +1,234 @@
+#include "main/materialized_view.h"
+
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct MaterializedViewBindData final : TableFuncBindData {
+    std::string viewName;
+    std::string query;
+    // Table ID of the view table. Only set once the view table exists.
+    table_id_t tableID;
+    std::shared_ptr<MaterializedViewDefinition> definition;
+
+    MaterializedViewBindData(std::string viewName, std::string query, table_id_t tableID,
+        std::shared_ptr<MaterializedViewDefinition> definition)
+        : TableFuncBindData{0}, viewName{std::move(viewName)}, query{std::move(query)},
+          tableID{tableID}, definition{std::move(definition)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<MaterializedViewBindData>(viewName, query, tableID, definition);
+    }
+};
+
+static IndexCatalogEntry* getViewEntry(const ClientContext& context, table_id_t tableID) {
+    return MaterializedViewCatalogEntry::getViewOfTable(*Catalog::Get(context),
+        transaction::Transaction::Get(context), tableID);
+}
+
+// The statements creating or dropping a view run in their own transaction, so that a failure
+// leaves neither a view table without a definition nor a definition without a view table.
+static void validateAutoTransaction(const ClientContext& context, const std::string& funcName) {
+    if (!transaction::TransactionContext::Get(context)->isAutoTransaction()) {
+        throw BinderException(
+            stringFormat("{} is only supported in auto transaction mode.", funcName));
+    }
+}
+
+static std::unique_ptr<TableFuncBindData> bindCreateFunc(ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, CreateMaterializedViewFunction::name);
+    auto viewName = input->getLiteralVal<std::string>(0);
+    auto query = input->getLiteralVal<std::string>(1);
+    if (Catalog::Get(*context)->containsTable(transaction::Transaction::Get(*context), viewName)) {
+        throw BinderException(stringFormat("Table {} already exists.", viewName));
+    }
+    auto definition = std::make_shared<MaterializedViewDefinition>(
+        MaterializedViewDefinition::bind(*context, query));
+    return std::make_unique<MaterializedViewBindData>(std::move(viewName), std::move(query),
+        INVALID_TABLE_ID, std::move(definition));
+}
+
+// The view table is created first, and the definition is registered on it in a second statement of
+// the same transaction. The view is populated when this transaction commits.
+static std::string createMaterializedViewQuery(ClientContext&, const TableFuncBindData& bindData) {
+    auto& viewBindData = *bindData.constPtrCast<MaterializedViewBindData>();
+    auto& definition = *viewBindData.definition;
+    std::string columns;
+    for (auto i = 0u; i < definition.columnNames.size(); i++) {
+        columns += stringFormat("`{}` {}, ", definition.columnNames[i],
+            definition.columnTypes[i].toString());
+    }
+    std::string query = "BEGIN TRANSACTION;";
+    query += stringFormat("CREATE NODE TABLE `{}` ({}PRIMARY KEY(`{}`));", viewBindData.viewName,
+        columns, definition.columnNames[0]);
+    query += stringFormat("CALL {}('{}', '{}');", InternalCreateMaterializedViewFunction::name,
+        MaterializedViewCatalogEntry::escapeStringLiteral(viewBindData.viewName),
+        MaterializedViewCatalogEntry::escapeStringLiteral(viewBindData.query));
+    query += "COMMIT;";
+    query += stringFormat("RETURN 'Materialized view {} has been created.' AS result;",
+        MaterializedViewCatalogEntry::escapeStringLiteral(viewBindData.viewName));
+    return query;
+}
+
+function_set CreateMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindCreateFunc;
+    func->tableFunc = TableFunction::emptyTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->rewriteFunc = createMaterializedViewQuery;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> bindInternalCreateFunc(ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto viewName = input->getLiteralVal<std::string>(0);
+    auto query = input->getLiteralVal<std::string>(1);
+    binder::Binder::validateTableExistence(*context, viewName);
+    auto tableEntry = Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), viewName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    if (getViewEntry(*context, tableEntry->getTableID()) != nullptr) {
+        throw BinderException(stringFormat("Table {} is already a materialized view.", viewName));
+    }
+    auto definition = std::make_shared<MaterializedViewDefinition>(
+        MaterializedViewDefinition::bind(*context, query));
+    auto properties = tableEntry->getProperties();
+    auto matches = properties.size() == definition->columnNames.size();
+    for (auto i = 0u; matches && i < properties.size(); i++) {
+        matches = properties[i].getName() == definition->columnNames[i] &&
+                  properties[i].getType() == definition->columnTypes[i];
+    }
+    if (!matches ||
+        std::ranges::find(definition->baseTableIDs, tableEntry->getTableID()) !=
+            definition->baseTableIDs.end()) {
+        throw BinderException(stringFormat(
+            "The columns of table {} do not match the result of the materialized view query.",
+            viewName));
+    }
+    return std::make_unique<MaterializedViewBindData>(std::move(viewName), std::move(query),
+        tableEntry->getTableID(), std::move(definition));
+}
+
+static offset_t internalCreateTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<MaterializedViewBindData>();
+    auto clientContext = input.context->clientContext;
+    auto& definition = *bindData.definition;
+    auto auxInfo = std::make_unique<MaterializedViewAuxInfo>(bindData.query,
+        definition.columnKinds, definition.baseTableIDs);
+    auto indexEntry = std::make_unique<IndexCatalogEntry>(MaterializedViewCatalogEntry::TYPE_NAME,
+        bindData.tableID, bindData.viewName, std::vector<property_id_t>{}, std::move(auxInfo));
+    Catalog::Get(*clientContext)
+        ->createIndex(transaction::Transaction::Get(*clientContext), std::move(indexEntry));
+    return 0;
+}
+
+function_set InternalCreateMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindInternalCreateFunc;
+    func->tableFunc = internalCreateTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> bindDropFunc(ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto viewName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, viewName);
+    auto tableEntry = Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), viewName);
+    auto viewEntry = getViewEntry(*context, tableEntry->getTableID());
+    if (viewEntry == nullptr) {
+        throw BinderException(stringFormat("Table {} is not a materialized view.", viewName));
+    }
+    return std::make_unique<MaterializedViewBindData>(std::move(viewName),
+        "" /* query */, tableEntry->getTableID(), nullptr /* definition */);
+}
+
+static std::unique_ptr<TableFuncBindData> bindPublicDropFunc(ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, DropMaterializedViewFunction::name);
+    return bindDropFunc(context, input);
+}
+
+static std::string dropMaterializedViewQuery(ClientContext&, const TableFuncBindData& bindData) {
+    auto& viewBindData = *bindData.constPtrCast<MaterializedViewBindData>();
+    std::string query = "BEGIN TRANSACTION;";
+    query += stringFormat("CALL {}('{}');", InternalDropMaterializedViewFunction::name,
+        MaterializedViewCatalogEntry::escapeStringLiteral(viewBindData.viewName));
+    query += stringFormat("DROP TABLE `{}`;", viewBindData.viewName);
+    query += "COMMIT;";
+    query += stringFormat("RETURN 'Materialized view {} has been dropped.' AS result;",
+        MaterializedViewCatalogEntry::escapeStringLiteral(viewBindData.viewName));
+    return query;
+}
+
+function_set DropMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindPublicDropFunc;
+    func->tableFunc = TableFunction::emptyTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->rewriteFunc = dropMaterializedViewQuery;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static offset_t internalDropTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<MaterializedViewBindData>();
+    auto clientContext = input.context->clientContext;
+    auto viewEntry = getViewEntry(*clientContext, bindData.tableID);
+    KU_ASSERT(viewEntry != nullptr);
+    Catalog::Get(*clientContext)
+        ->dropIndex(transaction::Transaction::Get(*clientContext), bindData.tableID,
+            viewEntry->getIndexName());
+    return 0;
+}
+
+function_set InternalDropMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindDropFunc;
+    func->tableFunc = internalDropTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
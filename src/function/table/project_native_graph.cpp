@@ -1,9 +1,12 @@
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/gds/gds.h"
+#include "function/gds/weight_utils.h"
 #include "function/table/bind_data.h"
 #include "function/table/bind_input.h"
 #include "function/table/standalone_call_function.h"
+#include "graph/csr_graph.h"
 #include "graph/graph_entry_set.h"
 #include "parser/parser.h"
 #include "processor/execution_context.h"
@@ -16,29 +19,89 @@ using namespace kuzu::graph;
 namespace kuzu {
 namespace function {
 
+struct ProjectGraphConfig {
+    // Materializes the edges of the graph in memory when an algorithm first runs on it.
+    bool inMemory = false;
+    // Rel property materialized as edge weight. Only used for in-memory graphs.
+    std::string weightProperty;
+
+    ProjectGraphConfig() = default;
+    explicit ProjectGraphConfig(const optional_params_t& optionalParams);
+};
+
+ProjectGraphConfig::ProjectGraphConfig(const optional_params_t& optionalParams) {
+    for (auto& [name, value] : optionalParams) {
+        auto lowerCaseName = StringUtils::getLower(name);
+        if (lowerCaseName == "in_memory") {
+            value.validateType(LogicalTypeID::BOOL);
+            inMemory = value.getValue<bool>();
+        } else if (lowerCaseName == "weight_property") {
+            value.validateType(LogicalTypeID::STRING);
+            weightProperty = value.getValue<std::string>();
+        } else {
+            throw BinderException{stringFormat("Unrecognized optional parameter {} in {}.", name,
+                ProjectGraphNativeFunction::name)};
+        }
+    }
+    if (!weightProperty.empty() && !inMemory) {
+        throw BinderException{"weight_property can only be set for in-memory graphs."};
+    }
+}
+
 struct ProjectGraphNativeBindData final : TableFuncBindData {
     std::string graphName;
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    ProjectGraphConfig config;
 
     ProjectGraphNativeBindData(std::string graphName,
         std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, ProjectGraphConfig config)
         : TableFuncBindData{0}, graphName{std::move(graphName)}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, config{std::move(config)} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+            config);
     }
 };
 
+// Edge weights of all rel tables are stored in a single array type, so the weight property must
+// exist with the same numeric type in all of them.
+static void validateWeightProperty(const NativeGraphEntry& graphEntry,
+    const std::string& weightProperty) {
+    std::optional<LogicalTypeID> weightTypeID;
+    for (auto& relInfo : graphEntry.relInfos) {
+        auto entry = relInfo.entry;
+        if (!entry->containsProperty(weightProperty)) {
+            throw BinderException(stringFormat("Cannot find property {} in {}.", weightProperty,
+                entry->getName()));
+        }
+        auto typeID = entry->getProperty(weightProperty).getType().getLogicalTypeID();
+        WeightUtils::visit(ProjectGraphNativeFunction::name, typeID, [](auto) {});
+        if (weightTypeID.has_value() && weightTypeID.value() != typeID) {
+            throw BinderException(stringFormat("Property {} must have the same type in all rel "
+                                               "tables of an in-memory graph.",
+                weightProperty));
+        }
+        weightTypeID = typeID;
+    }
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     const auto bindData = ku_dynamic_cast<ProjectGraphNativeBindData*>(input.bindData);
     auto graphEntrySet = GraphEntrySet::Get(*input.context->clientContext);
     graphEntrySet->validateGraphNotExist(bindData->graphName);
     auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos);
     // bind graph entry to check if input is valid or not. Ignore bind result.
-    GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    auto boundEntry = GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    auto& config = bindData->config;
+    if (config.inMemory) {
+        if (!config.weightProperty.empty()) {
+            validateWeightProperty(boundEntry, config.weightProperty);
+        }
+        entry->csrCache = std::make_shared<CSRGraphCache>(config.weightProperty);
+    }
     graphEntrySet->addGraph(bindData->graphName, std::move(entry));
     return 0;
 }
@@ -78,7 +141,8 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
     auto graphName = input->getLiteralVal<std::string>(0);
     auto nodeInfos = extractGraphEntryTableInfos(input->getValue(1));
     auto relInfos = extractGraphEntryTableInfos(input->getValue(2));
-    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+        ProjectGraphConfig{input->optionalParams});
 }
 
 function_set ProjectGraphNativeFunction::getFunctionSet() {
@@ -0,0 +1,69 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/result_cache.h"
+
+namespace kuzu {
+namespace function {
+
+struct ResultCacheInfoBindData final : TableFuncBindData {
+    main::ResultCacheStats stats;
+
+    ResultCacheInfoBindData(main::ResultCacheStats stats, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ResultCacheInfoBindData>(stats, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 8);
+    const auto& stats = input.bindData->constPtrCast<ResultCacheInfoBindData>()->stats;
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, stats.numEntries);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, stats.memoryUsage);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, stats.capacity);
+    output.getValueVectorMutable(3).setValue<uint64_t>(0, stats.numHits);
+    output.getValueVectorMutable(4).setValue<uint64_t>(0, stats.numMisses);
+    output.getValueVectorMutable(5).setValue<double>(0, stats.getHitRate());
+    output.getValueVectorMutable(6).setValue<uint64_t>(0, stats.numEvictions);
+    output.getValueVectorMutable(7).setValue<uint64_t>(0, stats.numInvalidations);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto stats = context->getDatabase()->getResultCache()->getStats();
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::DOUBLE());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames = std::vector<std::string>{"num_entries", "memory_usage", "capacity",
+        "num_hits", "num_misses", "hit_rate", "num_evictions", "num_invalidations"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<ResultCacheInfoBindData>(stats, columns);
+}
+
+function_set ResultCacheInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
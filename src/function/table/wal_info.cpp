@@ -0,0 +1,56 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+namespace kuzu {
+namespace function {
+
+struct WALInfoBindData final : TableFuncBindData {
+    storage::WALCompressionStats stats;
+
+    WALInfoBindData(storage::WALCompressionStats stats, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<WALInfoBindData>(stats, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 2);
+    const auto& stats = input.bindData->constPtrCast<WALInfoBindData>()->stats;
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, stats.numBytesBeforeCompression);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, stats.numBytesAfterCompression);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto stats = storage::StorageManager::Get(*context)->getWAL().getCompressionStats();
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames =
+        std::vector<std::string>{"num_bytes_before_compression", "num_bytes_after_compression"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<WALInfoBindData>(stats, columns);
+}
+
+function_set WALInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,382 @@
+#include "graph/csr_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/interrupt.h"
+#include "common/string_utils.h"
+#include "common/task_system/task_scheduler.h"
+#include "function/gds/frontier_morsel.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/local_storage/local_storage.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::main;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace graph {
+
+bool CSRGraphData::isValid(ClientContext& context) const {
+    if (Catalog::Get(context)->getVersion() != catalogVersion) {
+        return false;
+    }
+    auto startTS = Transaction::Get(context)->getStartTS();
+    auto transactionManager = TransactionManager::Get(context);
+    for (auto tableID : tableIDs) {
+        // Both the snapshot and the current transaction must see the last commit to the table.
+        auto lastCommitTS = transactionManager->getLastCommitTS(tableID);
+        if (lastCommitTS > snapshotTS || lastCommitTS > startTS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+CSRGraphNbrScanState::CSRGraphNbrScanState(const CSRRelTable& relTable, const CSRGraphData& data,
+    bool scanWeights, MemoryManager* mm)
+    : relTable{relTable}, weightSize{data.weightSize}, nbrNodes(DEFAULT_VECTOR_CAPACITY),
+      selVector{DEFAULT_VECTOR_CAPACITY} {
+    if (scanWeights) {
+        propertyVectors.push_back(
+            std::make_shared<ValueVector>(LogicalType(data.weightTypeID), mm));
+    }
+}
+
+void CSRGraphNbrScanState::startScan(offset_t offset, const CSRIndex& index) {
+    KU_ASSERT(offset + 1 < index.offsets.size());
+    currentIndex = &index;
+    nextPos = index.offsets[offset];
+    endPos = index.offsets[offset + 1];
+    selVector.setToUnfiltered(0);
+}
+
+bool CSRGraphNbrScanState::next() {
+    KU_ASSERT(currentIndex != nullptr);
+    while (nextPos < endPos) {
+        auto numNbrs = std::min(endPos - nextPos, DEFAULT_VECTOR_CAPACITY);
+        for (auto i = 0u; i < numNbrs; i++) {
+            nbrNodes[i] = nodeID_t{currentIndex->nbrOffsets[nextPos + i], currentIndex->nbrTableID};
+        }
+        if (!propertyVectors.empty()) {
+            memcpy(propertyVectors[0]->getData(),
+                currentIndex->weights.data() + nextPos * weightSize, numNbrs * weightSize);
+        }
+        nextPos += numNbrs;
+        if (nbrNodeMask == nullptr) {
+            selVector.setToUnfiltered(numNbrs);
+            return true;
+        }
+        auto buffer = selVector.getMutableBuffer();
+        sel_t numSelected = 0;
+        for (auto i = 0u; i < numNbrs; i++) {
+            buffer[numSelected] = i;
+            numSelected += nbrNodeMask->isMasked(nbrNodes[i].offset);
+        }
+        selVector.setToFiltered(numSelected);
+        if (numSelected > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const CSRGraphData* CSRGraph::getData() {
+    std::unique_lock lck{mtx};
+    if (!dataInitialized) {
+        data = cache->getData(context, *onDiskGraph);
+        dataInitialized = true;
+    }
+    return data.get();
+}
+
+std::unique_ptr<NbrScanState> CSRGraph::prepareRelScan(const TableCatalogEntry& entry,
+    oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties,
+    bool randomLookup) {
+    auto data = getData();
+    if (data == nullptr) {
+        return onDiskGraph->prepareRelScan(entry, relTableID, nbrTableID, std::move(relProperties),
+            randomLookup);
+    }
+    auto scanWeights = data->hasWeights && relProperties.size() == 1 &&
+                       StringUtils::caseInsensitiveEquals(relProperties[0], data->weightProperty);
+    if (!relProperties.empty() && !scanWeights) {
+        return onDiskGraph->prepareRelScan(entry, relTableID, nbrTableID, std::move(relProperties),
+            randomLookup);
+    }
+    KU_ASSERT(data->relTables.contains(relTableID));
+    auto state = std::make_unique<CSRGraphNbrScanState>(data->relTables.at(relTableID), *data,
+        scanWeights, MemoryManager::Get(*context->clientContext));
+    if (nodeOffsetMaskMap != nullptr && nodeOffsetMaskMap->containsTableID(nbrTableID)) {
+        state->nbrNodeMask = nodeOffsetMaskMap->getOffsetMask(nbrTableID);
+    }
+    return state;
+}
+
+Graph::EdgeIterator CSRGraph::scanFwd(nodeID_t nodeID, NbrScanState& state) {
+    auto csrScanState = dynamic_cast<CSRGraphNbrScanState*>(&state);
+    if (csrScanState == nullptr) {
+        return onDiskGraph->scanFwd(nodeID, state);
+    }
+    csrScanState->startScan(nodeID.offset, csrScanState->relTable.fwd);
+    return EdgeIterator(csrScanState);
+}
+
+Graph::EdgeIterator CSRGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
+    auto csrScanState = dynamic_cast<CSRGraphNbrScanState*>(&state);
+    if (csrScanState == nullptr) {
+        return onDiskGraph->scanBwd(nodeID, state);
+    }
+    csrScanState->startScan(nodeID.offset, csrScanState->relTable.bwd);
+    return EdgeIterator(csrScanState);
+}
+
+using morsel_func_t = std::function<void(FrontierMorselDispatcher&)>;
+
+// Runs a function on every worker thread. The threads share the node offset morsels handed out by
+// the dispatcher.
+class CSRBuildTask final : public Task {
+public:
+    CSRBuildTask(uint64_t maxNumThreads, offset_t maxOffset, morsel_func_t func)
+        : Task{maxNumThreads}, dispatcher{maxNumThreads}, func{std::move(func)} {
+        dispatcher.init(maxOffset);
+    }
+
+    void run() override { func(dispatcher); }
+
+private:
+    FrontierMorselDispatcher dispatcher;
+    morsel_func_t func;
+};
+
+static void runInParallel(ExecutionContext* context, offset_t maxOffset, morsel_func_t func) {
+    if (maxOffset == 0) {
+        return;
+    }
+    auto clientContext = context->clientContext;
+    auto task = std::make_shared<CSRBuildTask>(clientContext->getMaxNumThreadForExec(), maxOffset,
+        std::move(func));
+    // The snapshot is built by the first scan of an algorithm, which may run on a worker thread.
+    TaskScheduler::Get(*clientContext)
+        ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
+}
+
+// Turns per node degrees stored at offsets[i + 1] into the start position of each node.
+static void computePrefixSum(csr_vector_t<uint64_t>& offsets) {
+    for (auto i = 1u; i < offsets.size(); i++) {
+        offsets[i] += offsets[i - 1];
+    }
+}
+
+static void buildRelTable(ExecutionContext* context, OnDiskGraph& graph, const GraphRelInfo& info,
+    const CSRGraphData& data, CSRRelTable& relTable, std::atomic<bool>& hasNullWeights) {
+    auto& relGroupEntry = info.relGroupEntry->constCast<RelGroupCatalogEntry>();
+    // Only the stored direction is scanned. The other direction is derived from it in memory.
+    auto isFwdStored = relGroupEntry.getStorageDirection() != ExtendDirection::BWD;
+    auto& scanned = isFwdStored ? relTable.fwd : relTable.bwd;
+    auto& derived = isFwdStored ? relTable.bwd : relTable.fwd;
+    auto boundTableID = isFwdStored ? info.srcTableID : info.dstTableID;
+    scanned.nbrTableID = isFwdStored ? info.dstTableID : info.srcTableID;
+    derived.nbrTableID = boundTableID;
+    auto transaction = Transaction::Get(*context->clientContext);
+    auto numBoundNodes = graph.getMaxOffset(transaction, boundTableID);
+    auto numNbrNodes = graph.getMaxOffset(transaction, scanned.nbrTableID);
+    std::vector<std::string> properties;
+    if (data.hasWeights) {
+        properties.push_back(data.weightProperty);
+    }
+    auto prepareScan = [&]() {
+        return graph.prepareRelScan(*info.relGroupEntry, info.relTableID, scanned.nbrTableID,
+            properties, false /* randomLookup */);
+    };
+    auto scan = [&](offset_t offset, NbrScanState& state) {
+        auto nodeID = nodeID_t{offset, boundTableID};
+        return isFwdStored ? graph.scanFwd(nodeID, state) : graph.scanBwd(nodeID, state);
+    };
+
+    // First pass over the stored direction counts the degree of each node, the second one fills
+    // in the neighbours at the positions given by the prefix sum of the degrees.
+    scanned.offsets.assign(numBoundNodes + 1, 0);
+    runInParallel(context, numBoundNodes, [&](FrontierMorselDispatcher& dispatcher) {
+        auto state = prepareScan();
+        FrontierMorsel morsel;
+        while (dispatcher.getNextRangeMorsel(morsel)) {
+            for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); offset++) {
+                scanned.offsets[offset + 1] = scan(offset, *state).count();
+            }
+        }
+    });
+    computePrefixSum(scanned.offsets);
+    auto numEdges = scanned.offsets.back();
+    auto weightSize = data.hasWeights ? data.weightSize : 0;
+    scanned.nbrOffsets.resize(numEdges);
+    scanned.weights.resize(numEdges * weightSize);
+    runInParallel(context, numBoundNodes, [&](FrontierMorselDispatcher& dispatcher) {
+        auto state = prepareScan();
+        FrontierMorsel morsel;
+        while (dispatcher.getNextRangeMorsel(morsel)) {
+            for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); offset++) {
+                auto pos = scanned.offsets[offset];
+                for (auto chunk : scan(offset, *state)) {
+                    chunk.forEach([&](auto nbrNodes, auto propertyVectors, auto i) {
+                        scanned.nbrOffsets[pos] = nbrNodes[i].offset;
+                        if (weightSize > 0) {
+                            auto& weightVector = *propertyVectors[0];
+                            if (weightVector.isNull(i)) {
+                                hasNullWeights.store(true, std::memory_order_relaxed);
+                            }
+                            memcpy(scanned.weights.data() + pos * weightSize,
+                                weightVector.getData() + i * weightSize, weightSize);
+                        }
+                        pos++;
+                    });
+                }
+                KU_ASSERT(pos == scanned.offsets[offset + 1]);
+            }
+        }
+    });
+
+    // Edges are handed to neighbours concurrently, so the edges of each neighbour are sorted by
+    // their position in the stored direction afterwards to keep the layout deterministic.
+    auto mm = MemoryManager::Get(*context->clientContext);
+    csr_vector_t<std::atomic<uint64_t>> nextPositions(numNbrNodes + 1,
+        MmAllocator<std::atomic<uint64_t>>(mm));
+    runInParallel(context, numBoundNodes, [&](FrontierMorselDispatcher& dispatcher) {
+        FrontierMorsel morsel;
+        while (dispatcher.getNextRangeMorsel(morsel)) {
+            auto endEdge = scanned.offsets[morsel.getEndOffset()];
+            for (auto edge = scanned.offsets[morsel.getBeginOffset()]; edge < endEdge; edge++) {
+                nextPositions[scanned.nbrOffsets[edge] + 1].fetch_add(1,
+                    std::memory_order_relaxed);
+            }
+        }
+    });
+    derived.offsets.assign(numNbrNodes + 1, 0);
+    for (auto i = 0u; i < numNbrNodes; i++) {
+        derived.offsets[i + 1] = nextPositions[i + 1].load(std::memory_order_relaxed);
+    }
+    computePrefixSum(derived.offsets);
+    for (auto i = 0u; i < numNbrNodes; i++) {
+        nextPositions[i].store(derived.offsets[i], std::memory_order_relaxed);
+    }
+    csr_vector_t<uint64_t> scannedEdges(numEdges, MmAllocator<uint64_t>(mm));
+    runInParallel(context, numBoundNodes, [&](FrontierMorselDispatcher& dispatcher) {
+        FrontierMorsel morsel;
+        while (dispatcher.getNextRangeMorsel(morsel)) {
+            auto endEdge = scanned.offsets[morsel.getEndOffset()];
+            for (auto edge = scanned.offsets[morsel.getBeginOffset()]; edge < endEdge; edge++) {
+                auto pos = nextPositions[scanned.nbrOffsets[edge]].fetch_add(1,
+                    std::memory_order_relaxed);
+                scannedEdges[pos] = edge;
+            }
+        }
+    });
+    derived.nbrOffsets.resize(numEdges);
+    derived.weights.resize(numEdges * weightSize);
+    runInParallel(context, numNbrNodes, [&](FrontierMorselDispatcher& dispatcher) {
+        FrontierMorsel morsel;
+        while (dispatcher.getNextRangeMorsel(morsel)) {
+            for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); offset++) {
+                auto begin = scannedEdges.begin() + derived.offsets[offset];
+                auto end = scannedEdges.begin() + derived.offsets[offset + 1];
+                std::sort(begin, end);
+                for (auto pos = derived.offsets[offset]; pos < derived.offsets[offset + 1];
+                     pos++) {
+                    auto edge = scannedEdges[pos];
+                    // The node owning an edge is the last one starting at or before the edge.
+                    auto it =
+                        std::upper_bound(scanned.offsets.begin(), scanned.offsets.end(), edge);
+                    derived.nbrOffsets[pos] = it - scanned.offsets.begin() - 1;
+                    memcpy(derived.weights.data() + pos * weightSize,
+                        scanned.weights.data() + edge * weightSize, weightSize);
+                }
+            }
+        }
+    });
+}
+
+static table_id_set_t getTableIDs(OnDiskGraph& graph) {
+    table_id_set_t tableIDs;
+    for (auto nodeTableID : graph.getNodeTableIDs()) {
+        tableIDs.insert(nodeTableID);
+        for (auto& info : graph.getRelInfos(nodeTableID)) {
+            tableIDs.insert(info.relTableID);
+        }
+    }
+    return tableIDs;
+}
+
+static std::shared_ptr<const CSRGraphData> buildData(ExecutionContext* context,
+    OnDiskGraph& graph, const std::string& weightProperty, table_id_set_t tableIDs) {
+    auto clientContext = context->clientContext;
+    auto data = std::make_shared<CSRGraphData>();
+    data->snapshotTS = Transaction::Get(*clientContext)->getStartTS();
+    data->catalogVersion = Catalog::Get(*clientContext)->getVersion();
+    data->tableIDs = std::move(tableIDs);
+    data->weightProperty = weightProperty;
+    auto& relInfos = graph.getGraphEntry()->relInfos;
+    if (!weightProperty.empty() && !relInfos.empty()) {
+        // project_graph validates that all rel tables have the weight property with the same
+        // numeric type.
+        auto& type = relInfos[0].entry->getProperty(weightProperty).getType();
+        data->weightTypeID = type.getLogicalTypeID();
+        data->weightSize = PhysicalTypeUtils::getFixedTypeSize(type.getPhysicalType());
+        data->hasWeights = true;
+    }
+    auto mm = MemoryManager::Get(*clientContext);
+    std::atomic<bool> hasNullWeights = false;
+    for (auto nodeTableID : graph.getNodeTableIDs()) {
+        for (auto& info : graph.getRelInfos(nodeTableID)) {
+            if (clientContext->interrupted()) {
+                throw InterruptException{};
+            }
+            auto& relTable = data->relTables.emplace(info.relTableID, mm).first->second;
+            buildRelTable(context, graph, info, *data, relTable, hasNullWeights);
+        }
+    }
+    if (hasNullWeights) {
+        data->hasWeights = false;
+        for (auto& [_, relTable] : data->relTables) {
+            relTable.fwd.weights.clear();
+            relTable.fwd.weights.shrink_to_fit();
+            relTable.bwd.weights.clear();
+            relTable.bwd.weights.shrink_to_fit();
+        }
+    }
+    return data;
+}
+
+static bool hasLocalChanges(const ClientContext& context, const table_id_set_t& tableIDs) {
+    auto changedTableIDs = Transaction::Get(context)->getLocalStorage()->getChangedTableIDs();
+    return std::ranges::any_of(tableIDs,
+        [&](auto tableID) { return changedTableIDs.contains(tableID); });
+}
+
+std::shared_ptr<const CSRGraphData> CSRGraphCache::getData(ExecutionContext* context,
+    OnDiskGraph& onDiskGraph) {
+    auto clientContext = context->clientContext;
+    auto tableIDs = getTableIDs(onDiskGraph);
+    // A snapshot including uncommitted changes could not be shared with other transactions.
+    if (hasLocalChanges(*clientContext, tableIDs)) {
+        return nullptr;
+    }
+    std::unique_lock lck{mtx};
+    if (data == nullptr || data->tableIDs != tableIDs || !data->isValid(*clientContext)) {
+        data = buildData(context, onDiskGraph, weightProperty, std::move(tableIDs));
+    }
+    return data;
+}
+
+} // namespace graph
+} // namespace kuzu
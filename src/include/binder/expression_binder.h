@@ -143,12 +143,20 @@ public:
 
     const ExpressionBinderConfig& getConfig() { return config; }
 
+    // Whether a function whose result or effect depends on when the statement is bound has been
+    // folded, e.g. current_timestamp() or setseed().
+    bool hasFoldedBindTimeFunction() const { return foldedBindTimeFunction; }
+    // Whether a function returning a different value on each call, e.g. rand(), has been bound.
+    bool hasRandomFunction() const { return randomFunction; }
+
 private:
     Binder* binder;
     main::ClientContext* context;
     std::unordered_set<std::string> unknownParameters;
     std::unordered_map<std::string, std::shared_ptr<common::Value>> knownParameters;
     ExpressionBinderConfig config;
+    bool foldedBindTimeFunction = false;
+    bool randomFunction = false;
 };
 
 } // namespace binder
@@ -1454,6 +1454,12 @@ KUZU_C_API void kuzu_query_summary_destroy(kuzu_query_summary* query_summary);
  * @param query_summary The query summary to get compilation time.
  */
 KUZU_C_API double kuzu_query_summary_get_compiling_time(kuzu_query_summary* query_summary);
+/**
+ * @brief Returns the planning time of the given query summary in milliseconds. Planning time is
+ * part of the compilation time.
+ * @param query_summary The query summary to get planning time.
+ */
+KUZU_C_API double kuzu_query_summary_get_planning_time(kuzu_query_summary* query_summary);
 /**
  * @brief Returns the execution time of the given query summary in milliseconds.
  * @param query_summary The query summary to get execution time.
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "common/types/types.h"
+#include "common/utils.h"
+
+namespace kuzu {
+namespace common {
+
+// Register-blocked bloom filter over hash values. All bits of a key are set within a single 64-bit
+// block, so both insertion and lookup touch only one word of memory.
+// Note that this class is NOT thread-safe for insertion.
+class BlockedBloomFilter {
+public:
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    static constexpr uint64_t NUM_BITS_SET_PER_KEY = 4;
+    static constexpr uint64_t NUM_BITS_PER_BLOCK = 64;
+
+    explicit BlockedBloomFilter(uint64_t numKeys)
+        : blocks(nextPowerOfTwo(std::max<uint64_t>(1,
+                     (numKeys * NUM_BITS_PER_KEY + NUM_BITS_PER_BLOCK - 1) / NUM_BITS_PER_BLOCK)),
+              0) {}
+
+    void insert(hash_t hash) { blocks[getBlockIdx(hash)] |= getBlockMask(hash); }
+
+    bool mayContain(hash_t hash) const {
+        const auto blockMask = getBlockMask(hash);
+        return (blocks[getBlockIdx(hash)] & blockMask) == blockMask;
+    }
+
+    uint64_t getNumBytes() const { return blocks.size() * sizeof(uint64_t); }
+
+private:
+    // The lower bits of the hash pick the bits within a block, the upper bits pick the block.
+    uint64_t getBlockIdx(hash_t hash) const { return (hash >> 32) & (blocks.size() - 1); }
+
+    static uint64_t getBlockMask(hash_t hash) {
+        uint64_t blockMask = 0;
+        for (auto i = 0u; i < NUM_BITS_SET_PER_KEY; ++i) {
+            blockMask |= uint64_t(1) << ((hash >> (i * 6)) & (NUM_BITS_PER_BLOCK - 1));
+        }
+        return blockMask;
+    }
+
+private:
+    std::vector<uint64_t> blocks;
+};
+
+} // namespace common
+} // namespace kuzu
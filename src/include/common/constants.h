@@ -20,6 +20,18 @@ constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS = 5000000;
 
+// The background checkpointer checkpoints once no transaction has committed for this long.
+constexpr uint64_t BACKGROUND_CHECKPOINT_IDLE_TIME_IN_MICROS = 1000000;
+// With background checkpointing, commits checkpoint inline once the WAL grows past this factor of
+// the checkpoint threshold.
+constexpr uint64_t WAL_SIZE_HARD_LIMIT_FACTOR = 4;
+
+// Maximum number of logical plans kept in the database-wide plan cache.
+constexpr uint64_t DEFAULT_PLAN_CACHE_SIZE = 256;
+// Maximum number of bytes of query results kept in the database-wide result cache. The cache holds
+// memory of the buffer pool, so it is disabled by default.
+constexpr uint64_t DEFAULT_RESULT_CACHE_SIZE = 0;
+
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
 constexpr uint64_t CHUNK_RESIZE_RATIO = 2;
@@ -85,6 +97,16 @@ struct TableOptionConstants {
     static constexpr char REL_STORAGE_DIRECTION_OPTION[] = "STORAGE_DIRECTION";
 };
 
+// Column histogram configurations
+struct HistogramConstants {
+    static constexpr uint64_t NUM_BUCKETS = 64;
+    static constexpr uint64_t MAX_NUM_MOST_COMMON_VALUES = 16;
+    // Number of rows ANALYZE samples from each column.
+    static constexpr uint64_t ANALYZE_SAMPLE_SIZE = 32768;
+    // Number of newly inserted values kept per column to fold into an existing histogram.
+    static constexpr uint64_t INSERT_SAMPLE_CAPACITY = 256;
+};
+
 // Hash Index Configurations
 struct HashIndexConstants {
     static constexpr uint16_t SLOT_CAPACITY_BYTES = 256;
@@ -162,6 +184,12 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Join order enumeration of a query graph falls back to approximate planning for the remaining
+    // levels once it takes longer than this.
+    static constexpr uint64_t JOIN_ORDER_PLANNING_BUDGET_IN_MS = 200;
+    // Subgraph pairs of a dp level are planned by multiple threads only if there are enough of them
+    // to amortize scheduling a task.
+    static constexpr uint64_t MIN_NUM_SUBGRAPH_PAIRS_TO_PLAN_IN_PARALLEL = 32;
 };
 
 struct OrderByConstants {
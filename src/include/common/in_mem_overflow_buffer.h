@@ -59,6 +59,14 @@ public:
 
     storage::MemoryManager* getMemoryManager() { return memoryManager; }
 
+    uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->size();
+        }
+        return memoryUsage;
+    }
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return blocks.empty() ||
@@ -28,6 +28,7 @@ public:
 
     bool isEnabled() const { return enabled; }
     void enable() { enabled = true; }
+    void disable() { enabled = false; }
 
 private:
     offset_t maxOffset;
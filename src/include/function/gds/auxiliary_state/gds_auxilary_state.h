@@ -14,6 +14,8 @@ struct ExecutionContext;
 
 namespace function {
 
+class DeltaSteppingBuckets;
+
 // Maintain algorithm specific data structures
 class GDSAuxiliaryState {
 public:
@@ -29,6 +31,9 @@ public:
 
     virtual void switchToDense(processor::ExecutionContext* context, graph::Graph* graph) = 0;
 
+    // Buckets of pending nodes if the algorithm runs delta-stepping. Nullptr otherwise.
+    virtual DeltaSteppingBuckets* getDeltaSteppingBuckets() { return nullptr; }
+
     template<class TARGET>
     TARGET* ptrCast() {
         return common::ku_dynamic_cast<TARGET*>(this);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "function/gds/bfs_graph.h"
+#include "function/gds/delta_stepping_buckets.h"
 #include "gds_auxilary_state.h"
 
 namespace kuzu {
@@ -27,8 +28,19 @@ private:
 
 class WSPPathsAuxiliaryState : public GDSAuxiliaryState {
 public:
-    explicit WSPPathsAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager)
-        : bfsGraphManager{std::move(bfsGraphManager)} {}
+    // Run delta-stepping with the given bucket width if it is positive.
+    WSPPathsAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager, double bucketWidth)
+        : bfsGraphManager{std::move(bfsGraphManager)} {
+        if (bucketWidth > 0) {
+            auto manager = this->bfsGraphManager.get();
+            buckets = std::make_unique<DeltaSteppingBuckets>(bucketWidth,
+                [manager](common::nodeID_t nodeID) {
+                    auto parent = manager->getCurrentGraph()->getParentListHead(nodeID);
+                    return parent == nullptr ? std::numeric_limits<double>::max() :
+                                               parent->getCost();
+                });
+        }
+    }
 
     BFSGraphManager* getBFSGraphManager() { return bfsGraphManager.get(); }
 
@@ -46,9 +58,12 @@ public:
         bfsGraphManager->switchToDense(context, graph);
     }
 
+    DeltaSteppingBuckets* getDeltaSteppingBuckets() override { return buckets.get(); }
+
 private:
     std::unique_ptr<BFSGraphManager> bfsGraphManager;
     ParentList sourceParent;
+    std::unique_ptr<DeltaSteppingBuckets> buckets;
 };
 
 } // namespace function
@@ -24,6 +24,20 @@ public:
     virtual std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
         graph::NbrScanState::Chunk& results, bool fwdEdge) = 0;
 
+    // Returns true if bottomUpCompute is implemented, in which case recursive joins may run
+    // bottom-up iterations once the frontier covers a large part of the graph.
+    virtual bool supportsBottomUp() const { return false; }
+
+    // Bottom-up counterpart of edgeCompute, called on an unvisited node nodeID with a chunk of its
+    // neighbours over the reversed edges. fwdEdge is the direction of the edges as seen from the
+    // neighbours. Returns true if nodeID is reached from a neighbour in the current frontier, in
+    // which case the helper functions in GDSUtils put nodeID in the next frontier and stop
+    // scanning its edges.
+    virtual bool bottomUpCompute(common::nodeID_t /*nodeID*/,
+        graph::NbrScanState::Chunk& /*results*/, bool /*fwdEdge*/) {
+        KU_UNREACHABLE;
+    }
+
     virtual void resetSingleThreadState() {}
 
     virtual bool terminate(common::NodeOffsetMaskMap&) { return false; }
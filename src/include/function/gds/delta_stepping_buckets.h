@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace function {
+
+struct RJBindData;
+
+// Buckets of nodes for delta-stepping (Meyer & Sanders) weighted shortest paths. Bucket i holds
+// nodes reached with a cost in [i * bucketWidth, (i + 1) * bucketWidth). Only nodes of the
+// current bucket are put in the next frontier. Nodes reached with a larger cost wait in their
+// bucket until all buckets before it are empty, so most nodes are relaxed once with their final
+// cost instead of once per improvement.
+class DeltaSteppingBuckets {
+public:
+    DeltaSteppingBuckets(double bucketWidth, std::function<double(common::nodeID_t)> getCost)
+        : bucketWidth{bucketWidth}, getCost{std::move(getCost)} {}
+
+    // Returns the bucket width to run the recursive join with, or 0 to run the frontier loop.
+    // Iterations of delta-stepping don't extend paths by exactly one hop, so they can't enforce
+    // an upper bound given in the pattern.
+    static double getBucketWidth(const RJBindData& bindData, const main::ClientContext& context);
+
+    // Keep the node for a later bucket if the cost is beyond the current bucket. Returns true if
+    // the node was kept, false if it belongs to the next frontier. Thread-safe.
+    bool deferIfBeyondCurrentBucket(common::nodeID_t nodeID, double cost);
+
+    // Move to the first non-empty bucket and return its nodes. Entries of nodes whose cost
+    // improved since they were added are skipped. Returns an empty vector if all buckets are
+    // empty.
+    std::vector<common::nodeID_t> popNextBucket();
+
+private:
+    uint64_t getBucketIdx(double cost) const;
+
+private:
+    double bucketWidth;
+    std::function<double(common::nodeID_t)> getCost;
+    uint64_t curBucketIdx = 0;
+    std::mutex mtx;
+    std::map<uint64_t, std::vector<std::pair<common::nodeID_t, double>>> buckets;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -171,6 +171,18 @@ public:
 
     void setActiveNodesForNextIter() { hasActiveNodesForNextIter_.store(true); }
 
+    // Number of nodes put in the next frontier by frontier tasks. Nodes reached from several
+    // nodes of the current frontier may be counted more than once.
+    void addNumActiveNodesForNextIter(common::offset_t numNodes) {
+        numActiveNodesForNextIter.fetch_add(numNodes, std::memory_order_relaxed);
+    }
+    common::offset_t getNumActiveNodesForCurrentIter() const {
+        return numActiveNodesForCurrentIter;
+    }
+    common::offset_t getNumActiveNodesForNextIter() const {
+        return numActiveNodesForNextIter.load(std::memory_order_relaxed);
+    }
+
     bool continueNextIter(uint16_t maxIter) {
         return hasActiveNodesForNextIter_.load(std::memory_order_relaxed) &&
                getCurrentIter() < maxIter;
@@ -197,6 +209,11 @@ public:
     virtual bool needSwitchToDense(uint64_t threshold) const = 0;
     virtual void switchToDense(processor::ExecutionContext* context, graph::Graph* graph) = 0;
 
+    // Restarts counting iterations from 0 between two iterations. Nodes of the next frontier stay
+    // active and all other nodes are dropped from the frontiers. Lets an algorithm run more
+    // iterations than iteration_t can count.
+    virtual void resetIterations(processor::ExecutionContext*, graph::Graph*) { KU_UNREACHABLE; }
+
     template<class TARGET>
     TARGET* ptrCast() {
         return common::ku_dynamic_cast<TARGET*>(this);
@@ -210,6 +227,8 @@ protected:
     // curIter is the iteration number of the algorithm and starts from 0.
     iteration_t curIter = 0;
     std::atomic<bool> hasActiveNodesForNextIter_;
+    std::atomic<common::offset_t> numActiveNodesForNextIter{0};
+    common::offset_t numActiveNodesForCurrentIter = 0;
     Frontier* currentFrontier = nullptr;
     Frontier* nextFrontier = nullptr;
 };
@@ -232,6 +251,14 @@ public:
 
     std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override;
 
+    // Get the iteration a node was visited at, or FRONTIER_UNVISITED.
+    iteration_t getIteration(common::nodeID_t nodeID);
+    // Get all nodes first visited at the given iteration. Used for bidirectional search.
+    std::vector<common::nodeID_t> getNodesVisitedAtIter(iteration_t iter);
+    // Rewind so that the next iteration has the nodes visited at the given iteration as its
+    // current frontier. Used to walk back over the levels of a finished BFS.
+    void rewindToIter(iteration_t iter) { curIter = iter; }
+
     GDSDensityState getState() const override { return state; }
     bool needSwitchToDense(uint64_t threshold) const override {
         return state == GDSDensityState::SPARSE && sparseFrontier->size() > threshold;
@@ -264,6 +291,8 @@ public:
     }
     void switchToDense(processor::ExecutionContext* context, graph::Graph* graph) override;
 
+    void resetIterations(processor::ExecutionContext* context, graph::Graph* graph) override;
+
 private:
     GDSDensityState state;
     std::unique_ptr<DenseFrontier> curDenseFrontier = nullptr;
@@ -19,6 +19,9 @@ struct FrontierTaskInfo {
     common::ExtendDirection direction;
     EdgeCompute& edgeCompute;
     std::vector<std::string> propertiesToScan;
+    // If true, nodes of the nbr table that are not yet visited look for a neighbour in the current
+    // frontier by scanning their edges in the opposite direction.
+    bool bottomUp = false;
 
     FrontierTaskInfo(common::table_id_t srcTableID, common::table_id_t dstTableID,
         catalog::TableCatalogEntry* relGroupEntry, graph::Graph* graph,
@@ -30,7 +33,8 @@ struct FrontierTaskInfo {
     FrontierTaskInfo(const FrontierTaskInfo& other)
         : srcTableID{other.srcTableID}, dstTableID{other.dstTableID},
           relGroupEntry{other.relGroupEntry}, graph{other.graph}, direction{other.direction},
-          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan} {}
+          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan},
+          bottomUp{other.bottomUp} {}
 
     common::table_id_t getBoundTableID() const;
     common::table_id_t getNbrTableID() const;
@@ -56,6 +60,9 @@ public:
 
     void runSparse();
 
+private:
+    void runBottomUp();
+
 private:
     FrontierTaskInfo info;
     std::shared_ptr<FrontierTaskSharedState> sharedState;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/enums/extend_direction.h"
 #include "gds_state.h"
@@ -17,11 +19,23 @@ public:
     static void runFTSEdgeCompute(processor::ExecutionContext* context, GDSComputeState& compState,
         graph::Graph* graph, common::ExtendDirection extendDirection,
         const std::vector<std::string>& propertiesToScan);
+    // Run a single iteration of edge compute. Used by computations that do work between
+    // iterations.
+    static void runOneIterationEdgeCompute(processor::ExecutionContext* context,
+        GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
+        const std::vector<std::string>& propertiesToScan);
     // Run edge compute for recursive join.
     static void runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
         const std::vector<std::string>& propertiesToScan);
+    // Run recursive join edge compute from both ends of a single pair of nodes. Both compute
+    // states must use SPFrontierPair and have their source initialized. Returns the first node
+    // reached by both searches, which lies on a shortest path, if any.
+    static std::optional<common::nodeID_t> runBidirectionalRecursiveJoinEdgeCompute(
+        processor::ExecutionContext* context, GDSComputeState& srcState, GDSComputeState& dstState,
+        graph::Graph* graph, common::ExtendDirection extendDirection, uint64_t maxIteration,
+        const std::vector<std::string>& propertiesToScan);
 
     // Run vertex compute without property scan
     static void runVertexCompute(processor::ExecutionContext* context, GDSDensityState densityState,
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "function/gds/rec_joins.h"
+
+namespace kuzu {
+namespace function {
+
+class MSBFSAuxiliaryState;
+
+// Multi-source BFS (Then et al., "The More the Merrier: Efficient Multi-Source Graph Traversal")
+// computing single shortest path destinations and lengths from up to MAX_NUM_SOURCES sources at
+// once. Each node keeps one bit per source, so a node reached by several sources at the same
+// level scans its edges once for all of them.
+class MultiSourceBFS {
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = 64;
+    // With fewer sources, independent BFSs with sparse frontiers are cheaper than a batched BFS
+    // scanning dense frontiers.
+    static constexpr uint64_t MIN_NUM_SOURCES = 16;
+
+    MultiSourceBFS(processor::ExecutionContext* context, const RJBindData& bindData,
+        processor::RecursiveExtendSharedState* sharedState);
+
+    // Write the destinations reached from each of the given sources and their lengths.
+    void run(const std::vector<common::nodeID_t>& sourceNodeIDs);
+
+private:
+    processor::ExecutionContext* context;
+    processor::RecursiveExtendSharedState* sharedState;
+    common::ExtendDirection extendDirection;
+    uint16_t upperBound;
+    common::table_id_set_t outputTableIDs;
+    std::unique_ptr<GDSComputeState> computeState;
+    MSBFSAuxiliaryState* auxiliaryState;
+};
+
+} // namespace function
+} // namespace kuzu
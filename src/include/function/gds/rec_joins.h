@@ -20,6 +20,8 @@ struct RJBindData {
     // If lowerBound equals to 0, an empty path with source node only will be returned.
     uint16_t lowerBound = 0;
     uint16_t upperBound = 0;
+    // Whether the pattern gives the upper bound. Otherwise it defaults to the max var length depth.
+    bool hasExplicitUpperBound = false;
     common::PathSemantic semantic = common::PathSemantic::WALK;
 
     common::ExtendDirection extendDirection = common::ExtendDirection::FWD;
@@ -54,6 +56,16 @@ public:
         const RJBindData& bindData, GDSComputeState& computeState, common::nodeID_t sourceNodeID,
         processor::RecursiveExtendSharedState* sharedState) = 0;
 
+    // Whether the search can run from both ends when the query binds a single destination.
+    virtual bool supportsBidirectionalSearch() const { return false; }
+    // Merge the search started from the destination into the search started from the source once
+    // both searches reached meetNodeID, so that the output writer sees the destination as reached.
+    virtual void mergeBidirectionalSearch(GDSComputeState& /*srcState*/,
+        GDSComputeState& /*dstState*/, common::nodeID_t /*meetNodeID*/,
+        common::nodeID_t /*dstNodeID*/) const {
+        KU_UNREACHABLE;
+    }
+
     virtual std::unique_ptr<RJAlgorithm> copy() const = 0;
 };
 
@@ -62,6 +62,18 @@ struct CatalogVersionFunction final {
     static function_set getFunctionSet();
 };
 
+struct PlanCacheInfoFunction final {
+    static constexpr const char* name = "PLAN_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct ResultCacheInfoFunction final {
+    static constexpr const char* name = "RESULT_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct DBVersionFunction final {
     static constexpr const char* name = "DB_VERSION";
 
@@ -128,6 +140,18 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct CheckpointInfoFunction final {
+    static constexpr const char* name = "CHECKPOINT_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct WALInfoFunction final {
+    static constexpr const char* name = "WAL_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
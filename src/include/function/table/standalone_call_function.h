@@ -11,6 +11,39 @@ struct ClearWarningsFunction {
     static function_set getFunctionSet();
 };
 
+// Rebuilds the histograms of the numeric and temporal columns of a node table from a sample.
+struct AnalyzeFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
+// Creates a node table holding the result of an aggregate MATCH ... RETURN query and registers
+// the query so that the table is maintained on every commit.
+struct CreateMaterializedViewFunction {
+    static constexpr const char* name = "CREATE_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct InternalCreateMaterializedViewFunction {
+    static constexpr const char* name = "_CREATE_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct DropMaterializedViewFunction {
+    static constexpr const char* name = "DROP_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct InternalDropMaterializedViewFunction {
+    static constexpr const char* name = "_DROP_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
 struct ProjectGraphNativeFunction {
     static constexpr const char* name = "PROJECT_GRAPH";
 
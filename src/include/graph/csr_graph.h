@@ -0,0 +1,187 @@
+#pragma once
+
+#include <mutex>
+
+#include "graph.h"
+#include "on_disk_graph.h"
+#include "storage/buffer_manager/mm_allocator.h"
+
+namespace kuzu {
+namespace processor {
+struct ExecutionContext;
+} // namespace processor
+
+namespace graph {
+
+template<typename T>
+using csr_vector_t = std::vector<T, storage::MmAllocator<T>>;
+
+// Adjacency of one rel table in one direction in compressed sparse row format. The neighbours of
+// the node at offset i are nbrOffsets[offsets[i]] to nbrOffsets[offsets[i + 1] - 1]. All arrays
+// are allocated through the memory manager.
+struct CSRIndex {
+    common::table_id_t nbrTableID = common::INVALID_TABLE_ID;
+    csr_vector_t<uint64_t> offsets;
+    csr_vector_t<common::offset_t> nbrOffsets;
+    // Weight of each edge, laid out like nbrOffsets. Empty if the snapshot has no weights.
+    csr_vector_t<uint8_t> weights;
+
+    explicit CSRIndex(storage::MemoryManager* mm)
+        : offsets(storage::MmAllocator<uint64_t>(mm)),
+          nbrOffsets(storage::MmAllocator<common::offset_t>(mm)),
+          weights(storage::MmAllocator<uint8_t>(mm)) {}
+};
+
+struct CSRRelTable {
+    CSRIndex fwd;
+    CSRIndex bwd;
+
+    explicit CSRRelTable(storage::MemoryManager* mm) : fwd{mm}, bwd{mm} {}
+};
+
+// Read-only in-memory snapshot of the edges of a projected graph, with both directions of every
+// rel table and optionally the values of one numeric rel property used as edge weights. Rel
+// predicates of the projection are applied when the snapshot is built.
+struct CSRGraphData {
+    // Start timestamp of the transaction the snapshot was built in.
+    common::transaction_t snapshotTS = common::INVALID_TRANSACTION;
+    uint64_t catalogVersion = 0;
+    // Node and rel tables the snapshot was built from.
+    common::table_id_set_t tableIDs;
+    std::string weightProperty;
+    common::LogicalTypeID weightTypeID = common::LogicalTypeID::ANY;
+    uint32_t weightSize = 0;
+    // Weights are not materialized if some of them are NULL. Scans requesting the weight
+    // property then fall back to the on disk graph.
+    bool hasWeights = false;
+    common::table_id_map_t<CSRRelTable> relTables;
+
+    // Returns true if the snapshot shows the same edges as the rel tables seen by the current
+    // transaction of the given context.
+    bool isValid(main::ClientContext& context) const;
+};
+
+class CSRGraphNbrScanState final : public NbrScanState {
+    friend class CSRGraph;
+
+public:
+    CSRGraphNbrScanState(const CSRRelTable& relTable, const CSRGraphData& data, bool scanWeights,
+        storage::MemoryManager* mm);
+
+    Chunk getChunk() override {
+        return createChunk(std::span(nbrNodes), selVector, std::span(propertyVectors));
+    }
+    bool next() override;
+
+private:
+    void startScan(common::offset_t offset, const CSRIndex& index);
+
+private:
+    const CSRRelTable& relTable;
+    uint32_t weightSize;
+    common::SemiMask* nbrNodeMask = nullptr;
+
+    const CSRIndex* currentIndex = nullptr;
+    uint64_t nextPos = 0;
+    uint64_t endPos = 0;
+
+    std::vector<common::nodeID_t> nbrNodes;
+    common::SelectionVector selVector;
+    std::vector<std::shared_ptr<common::ValueVector>> propertyVectors;
+};
+
+class CSRGraphCache;
+
+// Graph serving neighbour scans from a CSRGraphData snapshot. Node scans and neighbour scans of
+// properties that are not in the snapshot are delegated to the on disk graph. The snapshot is
+// fetched from the cache by the first neighbour scan, so that mapping a plan that is never
+// executed, e.g. for EXPLAIN, does not build it.
+class KUZU_API CSRGraph final : public Graph {
+public:
+    CSRGraph(processor::ExecutionContext* context, std::shared_ptr<CSRGraphCache> cache,
+        std::unique_ptr<OnDiskGraph> onDiskGraph)
+        : context{context}, cache{std::move(cache)}, onDiskGraph{std::move(onDiskGraph)} {}
+
+    NativeGraphEntry* getGraphEntry() override { return onDiskGraph->getGraphEntry(); }
+
+    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) override {
+        nodeOffsetMaskMap = maskMap;
+        onDiskGraph->setNodeOffsetMask(maskMap);
+    }
+
+    std::vector<common::table_id_t> getNodeTableIDs() const override {
+        return onDiskGraph->getNodeTableIDs();
+    }
+
+    common::table_id_map_t<common::offset_t> getMaxOffsetMap(
+        transaction::Transaction* transaction) const override {
+        return onDiskGraph->getMaxOffsetMap(transaction);
+    }
+
+    common::offset_t getMaxOffset(transaction::Transaction* transaction,
+        common::table_id_t id) const override {
+        return onDiskGraph->getMaxOffset(transaction, id);
+    }
+
+    common::offset_t getNumNodes(transaction::Transaction* transaction) const override {
+        return onDiskGraph->getNumNodes(transaction);
+    }
+
+    std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override {
+        return onDiskGraph->getRelInfos(srcTableID);
+    }
+
+    std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties, bool randomLookup = true) override;
+
+    EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
+    EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
+
+    std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
+        const std::vector<std::string>& properties) override {
+        return onDiskGraph->prepareVertexScan(tableEntry, properties);
+    }
+
+    VertexIterator scanVertices(common::offset_t startNodeOffset,
+        common::offset_t endNodeOffsetExclusive, VertexScanState& scanState) override {
+        return onDiskGraph->scanVertices(startNodeOffset, endNodeOffsetExclusive, scanState);
+    }
+
+private:
+    // Returns the snapshot, or nullptr if all scans go to the on disk graph.
+    const CSRGraphData* getData();
+
+private:
+    processor::ExecutionContext* context;
+    std::shared_ptr<CSRGraphCache> cache;
+    std::unique_ptr<OnDiskGraph> onDiskGraph;
+    std::mutex mtx;
+    bool dataInitialized = false;
+    std::shared_ptr<const CSRGraphData> data;
+    common::NodeOffsetMaskMap* nodeOffsetMaskMap = nullptr;
+};
+
+// Snapshot of a projected graph shared by all algorithm calls on the projection. The snapshot is
+// rebuilt once a commit changes one of its tables and is released when the projection is dropped.
+class KUZU_API CSRGraphCache {
+public:
+    explicit CSRGraphCache(std::string weightProperty)
+        : weightProperty{std::move(weightProperty)} {}
+
+    const std::string& getWeightProperty() const { return weightProperty; }
+
+    // Returns the cached snapshot of the given graph, building it first if it is missing or
+    // outdated. Returns nullptr if the current transaction has uncommitted changes to the tables
+    // of the graph.
+    std::shared_ptr<const CSRGraphData> getData(processor::ExecutionContext* context,
+        OnDiskGraph& onDiskGraph);
+
+private:
+    std::mutex mtx;
+    std::string weightProperty;
+    std::shared_ptr<const CSRGraphData> data;
+};
+
+} // namespace graph
+} // namespace kuzu
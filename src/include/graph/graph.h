@@ -13,6 +13,9 @@ namespace kuzu {
 namespace catalog {
 class TableCatalogEntry;
 } // namespace catalog
+namespace common {
+class NodeOffsetMaskMap;
+} // namespace common
 namespace transaction {
 class Transaction;
 } // namespace transaction
@@ -181,6 +184,10 @@ public:
 
     virtual NativeGraphEntry* getGraphEntry() = 0;
 
+    // Restricts the nodes of the graph to the masked offsets. Nodes of tables without a mask are
+    // all included.
+    virtual void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) = 0;
+
     // Get id for all node tables.
     virtual std::vector<common::table_id_t> getNodeTableIDs() const = 0;
 
@@ -6,6 +6,7 @@
 
 namespace kuzu {
 namespace graph {
+class CSRGraphCache;
 
 struct NativeGraphEntryTableInfo {
     catalog::TableCatalogEntry* entry;
@@ -25,6 +26,8 @@ struct NativeGraphEntryTableInfo {
 struct KUZU_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // Set if the graph is projected with an in-memory snapshot.
+    std::shared_ptr<CSRGraphCache> csrCache;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -43,7 +46,7 @@ struct KUZU_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos}, csrCache{other.csrCache} {}
 };
 
 } // namespace graph
@@ -123,7 +123,9 @@ public:
 
     NativeGraphEntry* getGraphEntry() override { return &graphEntry; }
 
-    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) { nodeOffsetMaskMap = maskMap; }
+    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) override {
+        nodeOffsetMaskMap = maskMap;
+    }
 
     std::vector<common::table_id_t> getNodeTableIDs() const override {
         return graphEntry.getNodeTableIDs();
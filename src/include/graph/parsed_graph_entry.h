@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,7 @@
 
 namespace kuzu {
 namespace graph {
+class CSRGraphCache;
 
 enum class GraphEntryType : uint8_t {
     NATIVE = 0,
@@ -41,6 +43,9 @@ struct ParsedNativeGraphTableInfo {
 struct KUZU_API ParsedNativeGraphEntry : ParsedGraphEntry {
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    // In-memory snapshot shared by all algorithm calls on the graph. Null if the graph is read
+    // from disk.
+    std::shared_ptr<CSRGraphCache> csrCache;
 
     ParsedNativeGraphEntry(std::vector<ParsedNativeGraphTableInfo> nodeInfos,
         std::vector<ParsedNativeGraphTableInfo> relInfos)
@@ -13,6 +13,8 @@ struct ClientConfigDefault {
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr uint64_t SPARSE_FRONTIER_THRESHOLD = 1000;
+    // 0 means weighted shortest paths do not use delta-stepping by default.
+    static constexpr double WSP_BUCKET_WIDTH = 0;
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_ZONE_MAP = true;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
@@ -42,6 +44,8 @@ struct ClientConfig {
     uint32_t varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
     // Threshold determines when to switch from sparse frontier to dense frontier
     uint64_t sparseFrontierThreshold = ClientConfigDefault::SPARSE_FRONTIER_THRESHOLD;
+    // Bucket width of delta-stepping weighted shortest paths.
+    double wspBucketWidth = ClientConfigDefault::WSP_BUCKET_WIDTH;
     // If using progress bar.
     bool enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
     // time before displaying progress bar
@@ -22,6 +22,10 @@ class ProgressBar;
 class VirtualFileSystem;
 } // namespace common
 
+namespace binder {
+class BoundStatement;
+}
+
 namespace catalog {
 class Catalog;
 }
@@ -56,6 +60,8 @@ class AttachedKuzuDatabase;
 struct SpillToDiskSetting;
 struct ExtensionOption;
 class EmbeddedShell;
+struct PlanCacheEntry;
+class MaterializedViewMaintainer;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -79,6 +85,7 @@ class KUZU_API ClientContext {
     friend class common::RandomEngine;
     friend class common::ProgressBar;
     friend class graph::GraphEntrySet;
+    friend class MaterializedViewMaintainer;
 
 public:
     explicit ClientContext(Database* database);
@@ -199,6 +206,24 @@ private:
         bool shouldCommitNewTransaction,
         std::unordered_map<std::string, std::shared_ptr<common::Value>> inputParams = {});
 
+    // Returns an empty key if plans cannot be shared in the current state of this connection.
+    std::string getPlanCacheKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params) const;
+    static PrepareResult prepareFromPlanCache(const PlanCacheEntry& entry);
+    void addToPlanCache(const std::string& key, uint64_t catalogVersion,
+        const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement) const;
+    // Returns an empty key if results cannot be shared in the current state of this connection.
+    std::string getResultCacheKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params,
+        const QueryConfig& config) const;
+    std::string getQueryCacheKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params) const;
+    std::unique_ptr<QueryResult> lookupResultCache(const std::string& key,
+        uint64_t catalogVersion) const;
+    void addToResultCache(const std::string& key, uint64_t catalogVersion, uint64_t generation,
+        const CachedPreparedStatement& cachedStatement, const QueryResult& queryResult) const;
+
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> params,
@@ -212,6 +237,10 @@ private:
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         CachedPreparedStatement* cachedPreparedStatement,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Plans and executes a query that the caller has bound, and possibly rewritten, in the active
+    // transaction.
+    std::unique_ptr<QueryResult> executeBoundQueryNoLock(
+        const binder::BoundStatement& boundStatement);
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
 
@@ -32,6 +32,8 @@ class StorageExtension;
 
 namespace main {
 class DatabaseManager;
+class PlanCache;
+class ResultCache;
 /**
  * @brief Stores runtime configuration for creating or opening a Database
  */
@@ -161,6 +163,9 @@ public:
 
     common::VirtualFileSystem* getVFS() { return vfs.get(); }
 
+    PlanCache* getPlanCache() { return planCache.get(); }
+    ResultCache* getResultCache() { return resultCache.get(); }
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -198,6 +203,8 @@ private:
     std::vector<std::unique_ptr<extension::BinderExtension>> binderExtensions;
     std::vector<std::unique_ptr<extension::PlannerExtension>> plannerExtensions;
     std::vector<std::unique_ptr<extension::MapperExtension>> mapperExtensions;
+    std::unique_ptr<PlanCache> planCache;
+    std::unique_ptr<ResultCache> resultCache;
 };
 
 } // namespace main
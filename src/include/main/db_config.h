@@ -66,6 +66,10 @@ struct DBConfig {
     bool throwOnWalReplayFailure;
     bool enableChecksums;
     bool enableSpillingToDisk;
+    bool enableWALCompression;
+    bool backgroundCheckpoint;
+    uint64_t planCacheSize;
+    uint64_t resultCacheSize;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+
+namespace kuzu {
+namespace storage {
+class LocalStorage;
+} // namespace storage
+
+namespace main {
+class ClientContext;
+
+// How a column of a materialized view is combined with the rows computed from newly inserted
+// tuples of its base tables.
+enum class MaterializedViewColumnKind : uint8_t {
+    KEY = 0,
+    COUNT = 1,
+    SUM = 2,
+    MIN = 3,
+    MAX = 4,
+    // Any other expression, e.g. AVG or COUNT(DISTINCT). Views with such a column are recomputed
+    // from scratch on every change of their base tables.
+    OTHER = 5,
+};
+
+struct MaterializedViewAuxInfo final : catalog::IndexAuxInfo {
+    std::string query;
+    std::vector<MaterializedViewColumnKind> columnKinds;
+    // Node tables and rel groups scanned by the query.
+    std::vector<common::table_id_t> baseTableIDs;
+
+    MaterializedViewAuxInfo(std::string query, std::vector<MaterializedViewColumnKind> columnKinds,
+        std::vector<common::table_id_t> baseTableIDs)
+        : query{std::move(query)}, columnKinds{std::move(columnKinds)},
+          baseTableIDs{std::move(baseTableIDs)} {}
+
+    bool isIncrementallyMaintainable() const;
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+    static std::unique_ptr<MaterializedViewAuxInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+
+    std::unique_ptr<IndexAuxInfo> copy() override {
+        return std::make_unique<MaterializedViewAuxInfo>(*this);
+    }
+
+    // The view table and its data are exported like any other node table, so re-registering the
+    // definition on the imported table is sufficient.
+    std::string toCypher(const catalog::IndexCatalogEntry& indexEntry,
+        const catalog::ToCypherInfo& info) const override;
+};
+
+// The definition of a materialized view is stored as an index on the node table holding its
+// result.
+struct MaterializedViewCatalogEntry {
+    static constexpr char TYPE_NAME[] = "MATERIALIZED_VIEW";
+
+    static bool isMaterializedView(const catalog::IndexCatalogEntry& indexEntry) {
+        return indexEntry.getIndexType() == TYPE_NAME;
+    }
+    // Returns the aux info of a view entry, deserializing it if the entry was read from disk.
+    static const MaterializedViewAuxInfo& getAuxInfo(catalog::IndexCatalogEntry& indexEntry);
+    // Returns the first view that reads from the given node table or rel group, if any.
+    static catalog::IndexCatalogEntry* getViewReferencing(const catalog::Catalog& catalog,
+        const transaction::Transaction* transaction, common::table_id_t tableID);
+    // Returns the view whose result is stored in the given node table, if any.
+    static catalog::IndexCatalogEntry* getViewOfTable(const catalog::Catalog& catalog,
+        const transaction::Transaction* transaction, common::table_id_t tableID);
+
+    // Escapes a string so that it can be embedded in a single quoted string literal of the
+    // statements that create and drop views.
+    static std::string escapeStringLiteral(const std::string& str);
+};
+
+// A materialized view query bound and validated at creation time.
+struct MaterializedViewDefinition {
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    std::vector<MaterializedViewColumnKind> columnKinds;
+    std::vector<common::table_id_t> baseTableIDs;
+
+    // Throws a BinderException if the query is not a single MATCH ... RETURN query grouped by its
+    // first column.
+    static MaterializedViewDefinition bind(ClientContext& context, const std::string& query);
+};
+
+// Brings the materialized views of the database up to date with the writes of the committing
+// transaction. A view whose base tables only received inserts is maintained by evaluating its
+// query over the join results that contain at least one inserted tuple and merging the result into
+// the view. Any other change, e.g. an update, a delete or a COPY, recomputes the view.
+class MaterializedViewMaintainer {
+public:
+    explicit MaterializedViewMaintainer(ClientContext& context) : context{context} {}
+
+    void maintain();
+
+private:
+    void maintain(catalog::IndexCatalogEntry& viewEntry);
+
+    // Returns the rows of the view query. If insertedTableIDs is not empty, only join results that
+    // contain a tuple inserted into one of these tables are aggregated.
+    std::vector<std::vector<common::Value>> evaluate(const MaterializedViewAuxInfo& auxInfo,
+        const common::table_id_set_t& insertedTableIDs);
+    void merge(const catalog::TableCatalogEntry& viewTableEntry,
+        const MaterializedViewAuxInfo& auxInfo, std::vector<std::vector<common::Value>> rows);
+    void replace(const catalog::TableCatalogEntry& viewTableEntry,
+        std::vector<std::vector<common::Value>> rows);
+
+    void execute(const std::string& viewName, const std::string& query,
+        std::unordered_map<std::string, std::shared_ptr<common::Value>> params);
+
+private:
+    ClientContext& context;
+};
+
+} // namespace main
+} // namespace kuzu
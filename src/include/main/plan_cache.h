@@ -0,0 +1,99 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/value/value.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace parser {
+class Statement;
+} // namespace parser
+
+namespace binder {
+class Expression;
+} // namespace binder
+
+namespace main {
+
+// An optimized logical plan together with what is needed to execute it without going through the
+// parser, binder and planner again.
+struct PlanCacheEntry {
+    std::shared_ptr<parser::Statement> parsedStatement;
+    planner::LogicalPlan logicalPlan;
+    std::vector<std::shared_ptr<binder::Expression>> columns;
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameterMap;
+    bool isResultCacheable = false;
+};
+
+struct PlanCacheStats {
+    uint64_t numEntries = 0;
+    uint64_t capacity = 0;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numInvalidations = 0;
+
+    double getHitRate() const {
+        const auto numLookups = numHits + numMisses;
+        return numLookups == 0 ? 0 : static_cast<double>(numHits) / numLookups;
+    }
+};
+
+// Database-wide LRU cache of logical plans shared by all connections. Entries are keyed by
+// normalized query text together with the parameters and the planning related client settings the
+// plan was built with. Cached plans hold catalog entries, so the whole cache is invalidated as soon
+// as the catalog version it was filled under changes.
+class PlanCache {
+public:
+    explicit PlanCache(uint64_t capacity) : capacity{capacity} {}
+
+    // Drops comments, collapses whitespace outside of quoted strings and identifiers and strips
+    // trailing semicolons, so that trivially different spellings of a query share an entry.
+    static std::string normalizeQuery(std::string_view query);
+    // Plans embed the values of parameters (e.g. for SKIP/LIMIT and filter push down), so both the
+    // type and the value of each parameter are part of the key.
+    static std::string getParametersKey(
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters);
+
+    std::shared_ptr<const PlanCacheEntry> lookup(const std::string& key, uint64_t catalogVersion);
+    // Called after a cacheable plan had to be compiled, which is what is counted as a miss. Lookups
+    // of statements that turn out not to be cacheable do not affect the hit rate.
+    void insert(const std::string& key, uint64_t catalogVersion,
+        std::shared_ptr<const PlanCacheEntry> entry);
+
+    void setCapacity(uint64_t newCapacity);
+    void clear();
+
+    PlanCacheStats getStats() const;
+
+private:
+    void validateCatalogVersionNoLock(uint64_t catalogVersion);
+    void evictNoLock();
+
+private:
+    using lru_list_t = std::list<std::string>;
+    struct Slot {
+        std::shared_ptr<const PlanCacheEntry> entry;
+        lru_list_t::iterator lruPos;
+    };
+
+    mutable std::mutex mtx;
+    uint64_t capacity;
+    uint64_t catalogVersion = 0;
+    // Most recently used keys are at the front.
+    lru_list_t lruKeys;
+    std::unordered_map<std::string, Slot> slots;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numInvalidations = 0;
+};
+
+} // namespace main
+} // namespace kuzu
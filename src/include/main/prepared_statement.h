@@ -31,6 +31,14 @@ struct CachedPreparedStatement {
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Normalized text of a prepared query. Used to look up the plan cache on execution.
+    std::string normalizedQuery;
+    // Whether the plan only depends on the query, its parameters and the catalog, so that it can
+    // be shared with other connections through the plan cache.
+    bool isPlanCacheable = false;
+    // Whether, in addition, executing the plan twice on the same data yields the same result, so
+    // that its result can be cached.
+    bool isResultCacheable = false;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
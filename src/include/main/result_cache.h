@@ -0,0 +1,117 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+class FactorizedTable;
+} // namespace processor
+
+namespace planner {
+class LogicalPlan;
+} // namespace planner
+
+namespace main {
+
+// The materialized result of a read-only query together with the tables it was computed from.
+struct ResultCacheEntry {
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    std::shared_ptr<processor::FactorizedTable> table;
+    // Node tables and rel tables (not rel groups) scanned by the query.
+    common::table_id_set_t tableIDs;
+    // Set if the tables read by the query cannot be derived from its plan, e.g. for recursive
+    // joins. Such entries are invalidated by every commit that changes any table.
+    bool readsAllTables = false;
+    uint64_t memoryUsage = 0;
+
+    // Collects the tables read by a logical plan into tableIDs and readsAllTables.
+    void collectTables(const planner::LogicalPlan& plan);
+};
+
+struct ResultCacheStats {
+    uint64_t numEntries = 0;
+    uint64_t memoryUsage = 0;
+    uint64_t capacity = 0;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numInvalidations = 0;
+
+    double getHitRate() const {
+        const auto numLookups = numHits + numMisses;
+        return numLookups == 0 ? 0 : static_cast<double>(numHits) / numLookups;
+    }
+};
+
+// Database-wide LRU cache of query results bounded by the memory held by the cached factorized
+// tables. Entries use the same keys as the plan cache. An entry is dropped before a transaction
+// that changed one of the tables it reads makes its changes visible, and the whole cache is dropped
+// when the catalog version changes.
+class ResultCache {
+public:
+    explicit ResultCache(uint64_t capacity) : capacity{capacity} {}
+
+    // Must be read before the transaction computing a result to insert starts, so that commits
+    // racing with the computation are detected on insertion.
+    uint64_t getGeneration() const;
+
+    std::shared_ptr<const ResultCacheEntry> lookup(const std::string& key, uint64_t catalogVersion);
+    // The entry is not inserted if one of its tables has been invalidated after `generation` or
+    // is being invalidated, because the result may then reflect a snapshot older than the latest
+    // commit.
+    void insert(const std::string& key, uint64_t catalogVersion, uint64_t generation,
+        std::shared_ptr<const ResultCacheEntry> entry);
+    // Drops all entries reading one of the given tables and stops caching results that read them
+    // until finishInvalidation() is called. Called before a transaction that changed these tables
+    // makes its changes visible, so that no lookup returns a result older than the commit.
+    void startInvalidation(const common::table_id_set_t& tableIDs);
+    // Called once the changes are visible or the commit failed. Results computed from a snapshot
+    // taken before this call are still not inserted.
+    void finishInvalidation(const common::table_id_set_t& tableIDs);
+
+    void setCapacity(uint64_t newCapacity);
+    void clear();
+
+    ResultCacheStats getStats() const;
+
+private:
+    void validateCatalogVersionNoLock(uint64_t catalogVersion);
+    void invalidateNoLock(const common::table_id_set_t& tableIDs);
+    void eraseNoLock(const std::string& key);
+    void evictNoLock();
+
+private:
+    using lru_list_t = std::list<std::string>;
+    struct Slot {
+        std::shared_ptr<const ResultCacheEntry> entry;
+        lru_list_t::iterator lruPos;
+    };
+
+    mutable std::mutex mtx;
+    uint64_t capacity;
+    uint64_t memoryUsage = 0;
+    uint64_t catalogVersion = 0;
+    uint64_t generation = 0;
+    // Generation at which each table was last invalidated.
+    std::unordered_map<common::table_id_t, uint64_t> tableGenerations;
+    // Number of commits changing each table that have started but not finished invalidation.
+    std::unordered_map<common::table_id_t, uint64_t> numPendingInvalidations;
+    // Most recently used keys are at the front.
+    lru_list_t lruKeys;
+    std::unordered_map<std::string, Slot> slots;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numInvalidations = 0;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -47,6 +47,13 @@ struct SparseFrontierThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct WSPBucketWidthSetting {
+    static constexpr auto name = "wsp_bucket_width";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct EnableSemiMaskSetting {
     static constexpr auto name = "enable_semi_mask";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -145,5 +152,33 @@ struct EnableInternalCatalogSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct BackgroundCheckpointSetting {
+    static constexpr auto name = "background_checkpoint";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct WALCompressionSetting {
+    static constexpr auto name = "wal_compression";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct PlanCacheSizeSetting {
+    static constexpr auto name = "plan_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ResultCacheSizeSetting {
+    static constexpr auto name = "result_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 } // namespace main
 } // namespace kuzu
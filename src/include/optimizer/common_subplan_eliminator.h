@@ -0,0 +1,41 @@
+#pragma once
+
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer detects read-only subplans that appear multiple times in a query, e.g. the same
+// pattern matched in several UNION branches, and wraps every occurrence into a
+// LogicalCommonSubplan. The subplan is then evaluated once and its result is shared by all
+// occurrences.
+// Two subplans are considered identical if they have the same operators, tables, predicates and
+// projections up to the renaming of variables.
+class CommonSubplanEliminator {
+    // Parent operator and child index of a subplan occurrence.
+    using occurrence_t = std::pair<planner::LogicalOperator*, common::idx_t>;
+
+public:
+    void rewrite(const planner::LogicalPlan* plan);
+
+private:
+    void collectSIPTargets(const planner::LogicalOperator* op);
+    bool collectFingerprints(planner::LogicalOperator* op);
+    void collectOccurrences(planner::LogicalOperator* op);
+
+    bool tryShare(const std::vector<occurrence_t>& subplanOccurrences);
+
+private:
+    // Operators referenced by semi maskers or bloom filter builders cannot be shared because the
+    // referencing operator expects to find them in the physical plan.
+    std::unordered_set<const planner::LogicalOperator*> sipTargets;
+    std::unordered_map<const planner::LogicalOperator*, std::string> fingerprints;
+    std::unordered_map<std::string, common::idx_t> numFingerprints;
+    // Occurrences grouped by fingerprint, in the order fingerprints are first found.
+    std::vector<std::string> orderedFingerprints;
+    std::unordered_map<std::string, std::vector<occurrence_t>> occurrences;
+    common::idx_t nextSubplanID = 0;
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <map>
+
 #include "binder/query/query_graph.h"
+#include "common/enums/extend_direction.h"
+#include "common/enums/rel_direction.h"
 #include "planner/operator/logical_plan.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/stats/table_stats.h"
 
 namespace kuzu {
@@ -25,6 +30,10 @@ public:
     void init(const binder::QueryGraph& queryGraph);
     KUZU_API void init(const binder::NodeExpression& node);
 
+    // Degree statistics are otherwise cached lazily. Caching them upfront allows multiple threads
+    // to estimate cardinalities of the query graph concurrently.
+    void cacheDegreeStats(const binder::QueryGraph& queryGraph) const;
+
     void rectifyCardinality(const binder::Expression& nodeID, cardinality_t card);
 
     cardinality_t estimateScanNode(const LogicalOperator& op) const;
@@ -32,24 +41,35 @@ public:
         const LogicalOperator& probeOp, const LogicalOperator& buildOp) const;
     cardinality_t estimateCrossProduct(const LogicalOperator& probeOp,
         const LogicalOperator& buildOp) const;
-    cardinality_t estimateIntersect(const binder::expression_vector& joinNodeIDs,
-        const LogicalOperator& probeOp, const std::vector<LogicalOperator*>& buildOps) const;
+    cardinality_t estimateIntersect(const binder::Expression& intersectNodeID,
+        const binder::expression_vector& boundNodeIDs, const LogicalOperator& probeOp,
+        const std::vector<LogicalOperator*>& buildOps) const;
     cardinality_t estimateFlatten(const LogicalOperator& childOp,
         f_group_pos groupPosToFlatten) const;
     cardinality_t estimateFilter(const LogicalOperator& childOp,
         const binder::Expression& predicate) const;
     cardinality_t estimateAggregate(const LogicalAggregate& op) const;
 
+    // `boundNodeCard` is the number of bound nodes the extension starts from. The average degree is
+    // scaled down for a small number of bound nodes if the degree distribution is skewed.
     double getExtensionRate(const binder::RelExpression& rel,
-        const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
+        const binder::NodeExpression& boundNode, common::ExtendDirection direction,
+        cardinality_t boundNodeCard, const transaction::Transaction* transaction) const;
     cardinality_t multiply(double extensionRate, cardinality_t card) const;
+    // Expected length of the adjacency list that an intersect build side holds for one probe tuple.
+    // Derived from the degree statistics of the rel the build side extends over.
+    double getIntersectListLength(const binder::Expression& boundNodeID,
+        const LogicalOperator& probeOp, const LogicalOperator& buildOp) const;
 
 private:
+    double estimateJoinConditionSelectivity(const binder::expression_pair& joinCondition) const;
     cardinality_t getNodeIDDom(const std::string& nodeIDName) const;
     cardinality_t getNumNodes(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
     cardinality_t getNumRels(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
+    storage::DegreeStats getDegreeStats(const std::vector<common::table_id_t>& relTableIDs,
+        common::ExtendDirection direction) const;
 
 private:
     main::ClientContext* context;
@@ -57,6 +77,9 @@ private:
     std::unordered_map<common::table_id_t, storage::TableStats> nodeTableStats;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
     std::unordered_map<std::string, cardinality_t> nodeIDName2dom;
+    // Degree statistics are aggregated over all node groups of a rel table, so we cache them.
+    mutable std::map<std::pair<common::table_id_t, common::RelDataDirection>, storage::DegreeStats>
+        relDegreeStats;
 };
 
 } // namespace planner
@@ -16,8 +16,10 @@ public:
         const LogicalPlan& probe, const LogicalPlan& build);
     static uint64_t computeMarkJoinCost(const binder::expression_vector& joinNodeIDs,
         const LogicalPlan& probe, const LogicalPlan& build);
-    static uint64_t computeIntersectCost(const LogicalPlan& probePlan,
-        const std::vector<LogicalPlan>& buildPlans);
+    // `listLengths` holds the expected adjacency list length of each build side per probe tuple.
+    static uint64_t computeIntersectCost(const binder::expression_vector& boundNodeIDs,
+        const LogicalPlan& probePlan, const std::vector<LogicalPlan>& buildPlans,
+        const std::vector<double>& listLengths);
 };
 
 } // namespace planner
@@ -1,18 +1,33 @@
 #pragma once
 
+#include "common/constants.h"
+#include "common/timer.h"
 #include "planner/operator/logical_plan.h"
 #include "planner/subplans_table.h"
 
 namespace kuzu {
 namespace planner {
 
+// A plan enumerated for a subgraph that is yet to be added to the subplans table.
+struct SubgraphPlan {
+    binder::SubqueryGraph subgraph;
+    LogicalPlan plan;
+    // Cost of the hash join producing the plan as estimated before the plan was built. Hash join
+    // plans are pruned by comparing this cost against the max cost of the subgraph's plans.
+    uint64_t joinCost;
+
+    SubgraphPlan(binder::SubqueryGraph subgraph, LogicalPlan plan, uint64_t joinCost = 0)
+        : subgraph{std::move(subgraph)}, plan{std::move(plan)}, joinCost{joinCost} {}
+};
+using subgraph_plan_vector_t = std::vector<SubgraphPlan>;
+
 class JoinOrderEnumeratorContext {
     friend class Planner;
 
 public:
     JoinOrderEnumeratorContext()
-        : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+        : currentLevel{0}, maxLevel{0}, plannedApproximately{false},
+          subPlansTable{std::make_unique<SubPlansTable>()}, queryGraph{nullptr} {}
     DELETE_COPY_DEFAULT_MOVE(JoinOrderEnumeratorContext);
 
     void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates);
@@ -28,6 +43,18 @@ public:
     void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan) {
         subPlansTable->addPlan(subqueryGraph, std::move(plan));
     }
+    void addPlans(subgraph_plan_vector_t plans) {
+        for (auto& subgraphPlan : plans) {
+            subPlansTable->addPlan(subgraphPlan.subgraph, std::move(subgraphPlan.plan));
+        }
+    }
+
+    // Whether enumerating join orders of the current query graph took longer than the planning
+    // budget.
+    bool exceedsPlanningBudget() const {
+        return planningTimer.getElapsedTimeInMS() >
+               common::PlannerKnobs::JOIN_ORDER_PLANNING_BUDGET_IN_MS;
+    }
 
     binder::SubqueryGraph getEmptySubqueryGraph() const {
         return binder::SubqueryGraph(*queryGraph);
@@ -43,6 +70,9 @@ private:
 
     uint32_t currentLevel;
     uint32_t maxLevel;
+    // Whether some level was planned approximately.
+    bool plannedApproximately;
+    common::Timer planningTimer;
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     const binder::QueryGraph* queryGraph;
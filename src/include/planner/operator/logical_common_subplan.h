@@ -0,0 +1,43 @@
+#pragma once
+
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Wraps one occurrence of a subplan that appears multiple times in the same query. All
+// LogicalCommonSubplan operators sharing a subplanID compute the same result, so the subplan is
+// materialized only once and every occurrence scans the materialized result. Payloads of all
+// occurrences are aligned, i.e. the i-th payload of each occurrence refers to the same column.
+class LogicalCommonSubplan final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::COMMON_SUBPLAN;
+
+public:
+    LogicalCommonSubplan(common::idx_t subplanID, binder::expression_vector payloads,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, subplanID{subplanID},
+          payloads{std::move(payloads)} {
+        cardinality = children[0]->getCardinality();
+    }
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override {
+        return "Subplan " + std::to_string(subplanID);
+    }
+
+    common::idx_t getSubplanID() const { return subplanID; }
+    binder::expression_vector getPayloads() const { return payloads; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalCommonSubplan>(subplanID, payloads, children[0]->copy());
+    }
+
+private:
+    common::idx_t subplanID;
+    binder::expression_vector payloads;
+};
+
+} // namespace planner
+} // namespace kuzu
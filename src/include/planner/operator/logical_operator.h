@@ -15,6 +15,9 @@ enum class LogicalOperatorType : uint8_t {
     AGGREGATE,
     ALTER,
     ATTACH_DATABASE,
+    BLOOM_FILTER_BUILDER,
+    BLOOM_FILTER_PROBE,
+    COMMON_SUBPLAN,
     COPY_FROM,
     COPY_TO,
     CREATE_MACRO,
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "common/exception/runtime.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Inserts the hash of key into a bloom filter which is passed to the target BloomFilterProbe
+// operators. Unlike semi masks, bloom filters work for keys of any type and for any scan that
+// produces the key, e.g. rel scans and table function scans.
+class LogicalBloomFilterBuilder final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::BLOOM_FILTER_BUILDER;
+
+public:
+    LogicalBloomFilterBuilder(std::shared_ptr<binder::Expression> key,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, key{std::move(key)} {}
+
+    void computeFactorizedSchema() override { copyChildSchema(0); }
+    void computeFlatSchema() override { copyChildSchema(0); }
+
+    std::string getExpressionsForPrinting() const override { return key->toString(); }
+
+    std::shared_ptr<binder::Expression> getKey() const { return key; }
+
+    void addTarget(const LogicalOperator* op) { targetOps.push_back(op); }
+    std::vector<const LogicalOperator*> getTargetOperators() const { return targetOps; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        if (!targetOps.empty()) {
+            throw common::RuntimeException(
+                "LogicalBloomFilterBuilder::copy() should not be called when ops "
+                "is not empty. Raw pointers will be point to corrupted object after copy.");
+        }
+        return std::make_unique<LogicalBloomFilterBuilder>(key, children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> key;
+    // Operators accepting bloom filter
+    std::vector<const LogicalOperator*> targetOps;
+};
+
+// Drops tuples whose key is not contained in the bloom filter of a LogicalBloomFilterBuilder. It is
+// placed directly on top of the scan producing key.
+class LogicalBloomFilterProbe final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::BLOOM_FILTER_PROBE;
+
+public:
+    LogicalBloomFilterProbe(std::shared_ptr<binder::Expression> key,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, key{std::move(key)} {}
+
+    void computeFactorizedSchema() override { copyChildSchema(0); }
+    void computeFlatSchema() override { copyChildSchema(0); }
+
+    std::string getExpressionsForPrinting() const override { return key->toString(); }
+
+    std::shared_ptr<binder::Expression> getKey() const { return key; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalBloomFilterProbe>(key, children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> key;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -187,6 +187,22 @@ public:
     void planInnerHashJoin(const binder::SubqueryGraph& subgraph,
         const binder::SubqueryGraph& otherSubgraph,
         const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes, bool flipPlan);
+    // Same as above but collect plans into result instead of adding them to the subplans table,
+    // so that multiple subgraph pairs of a level can be planned concurrently. Hash join plans
+    // whose join cost is not below maxCost are skipped.
+    bool tryPlanINLJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& otherSubgraph,
+        const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes,
+        subgraph_plan_vector_t& result);
+    void planInnerHashJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& otherSubgraph,
+        const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes, bool flipPlan,
+        uint64_t maxCost, subgraph_plan_vector_t& result);
+    bool canPlanInnerJoinsInParallel(uint64_t numSubgraphPairs) const;
+
+    // Plan greedy operator ordering (GOO) as a fallback for query graphs too large to enumerate
+    // exactly. Returns an empty plan if no plan is found.
+    LogicalPlan planJoinOrderGreedily();
 
     // Plan semi mask
     void appendNodeSemiMask(SemiMaskTargetType targetType, const binder::NodeExpression& node,
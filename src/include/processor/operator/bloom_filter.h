@@ -0,0 +1,136 @@
+#pragma once
+
+#include <mutex>
+
+#include "common/bloom_filter.h"
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/physical_operator.h"
+#include "storage/buffer_manager/mm_allocator.h"
+
+namespace kuzu {
+namespace binder {
+class Expression;
+} // namespace binder
+
+namespace processor {
+
+// Hashes collected by one thread. They are allocated through the memory manager so that large
+// build sides count against the buffer pool.
+using bloom_filter_hashes_t = std::vector<common::hash_t, storage::MmAllocator<common::hash_t>>;
+
+class BloomFilterSharedState {
+public:
+    bloom_filter_hashes_t* appendLocalHashes(storage::MemoryManager* mm);
+
+    // Builds the global bloom filter from the hashes collected by all threads. This happens once
+    // the pipeline producing the keys has finished, so the filter is sized by the true number of
+    // keys.
+    void mergeToGlobal();
+
+    const common::BlockedBloomFilter* getBloomFilter() const { return bloomFilter.get(); }
+
+private:
+    std::vector<std::unique_ptr<bloom_filter_hashes_t>> localHashes;
+    std::unique_ptr<common::BlockedBloomFilter> bloomFilter;
+    std::mutex mtx;
+};
+
+struct BloomFilterBuilderPrintInfo final : OPPrintInfo {
+    std::vector<std::string> operatorNames;
+
+    explicit BloomFilterBuilderPrintInfo(std::vector<std::string> operatorNames)
+        : operatorNames{std::move(operatorNames)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<BloomFilterBuilderPrintInfo>(
+            new BloomFilterBuilderPrintInfo(*this));
+    }
+
+private:
+    BloomFilterBuilderPrintInfo(const BloomFilterBuilderPrintInfo& other)
+        : OPPrintInfo{other}, operatorNames{other.operatorNames} {}
+};
+
+class BloomFilterBuilder final : public PhysicalOperator {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::BLOOM_FILTER_BUILDER;
+
+public:
+    BloomFilterBuilder(DataPos keyPos, std::shared_ptr<BloomFilterSharedState> sharedState,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)}, keyPos{keyPos},
+          keyVector{nullptr}, sharedState{std::move(sharedState)}, localHashes{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    void finalizeInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<BloomFilterBuilder>(keyPos, sharedState, children[0]->copy(), id,
+            printInfo->copy());
+    }
+
+private:
+    DataPos keyPos;
+    common::ValueVector* keyVector;
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::shared_ptr<BloomFilterSharedState> sharedState;
+    bloom_filter_hashes_t* localHashes;
+};
+
+struct BloomFilterProbePrintInfo final : OPPrintInfo {
+    std::shared_ptr<binder::Expression> key;
+
+    explicit BloomFilterProbePrintInfo(std::shared_ptr<binder::Expression> key)
+        : key{std::move(key)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<BloomFilterProbePrintInfo>(new BloomFilterProbePrintInfo(*this));
+    }
+
+private:
+    BloomFilterProbePrintInfo(const BloomFilterProbePrintInfo& other)
+        : OPPrintInfo{other}, key{other.key} {}
+};
+
+// Drops tuples whose key cannot join with the build side of a hash join. A tuple passes only if its
+// key is contained in all bloom filters passed into this operator.
+class BloomFilterProbe final : public PhysicalOperator, public SelVectorOverWriter {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::BLOOM_FILTER_PROBE;
+
+public:
+    BloomFilterProbe(DataPos keyPos, std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)}, keyPos{keyPos},
+          keyVector{nullptr} {}
+
+    void addSharedState(std::shared_ptr<BloomFilterSharedState> sharedState) {
+        sharedStates.push_back(std::move(sharedState));
+    }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        auto result = std::make_unique<BloomFilterProbe>(keyPos, children[0]->copy(), id,
+            printInfo->copy());
+        result->sharedStates = sharedStates;
+        return result;
+    }
+
+private:
+    DataPos keyPos;
+    common::ValueVector* keyVector;
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::vector<std::shared_ptr<BloomFilterSharedState>> sharedStates;
+};
+
+} // namespace processor
+} // namespace kuzu
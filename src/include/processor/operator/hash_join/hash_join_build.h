@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
 
 #include "binder/expression/expression.h"
 #include "join_hash_table.h"
@@ -83,6 +84,15 @@ public:
 
     std::shared_ptr<HashJoinSharedState> getSharedState() const { return sharedState; }
 
+    // Planner estimate of the number of build side tuples. Reported next to the true number of
+    // tuples when profiling.
+    void setEstimatedCardinality(common::cardinality_t cardinality) {
+        estimatedCardinality = cardinality;
+    }
+
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     void executeInternal(ExecutionContext* context) override;
@@ -90,8 +100,10 @@ public:
     void finalizeInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return make_unique<HashJoinBuild>(operatorType, sharedState, info.copy(),
+        auto result = make_unique<HashJoinBuild>(operatorType, sharedState, info.copy(),
             children[0]->copy(), id, printInfo->copy());
+        result->estimatedCardinality = estimatedCardinality;
+        return result;
     }
 
 protected:
@@ -112,6 +124,9 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+
+private:
+    std::optional<common::cardinality_t> estimatedCardinality;
 };
 
 } // namespace processor
@@ -78,12 +78,21 @@ public:
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return make_unique<HashJoinProbe>(sharedState, joinType, flatProbe, probeDataInfo,
             children[0]->copy(), id, printInfo->copy());
     }
 
 private:
+    // An inner join with an empty build side has no result, so the probe side is not evaluated.
+    bool canSkipProbeSide() const {
+        return joinType == common::JoinType::INNER &&
+               sharedState->getHashTable()->getNumEntries() == 0;
+    }
+
     bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
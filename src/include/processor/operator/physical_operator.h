@@ -21,6 +21,8 @@ enum class PhysicalOperatorType : uint8_t {
     AGGREGATE_SCAN,
     ATTACH_DATABASE,
     BATCH_INSERT,
+    BLOOM_FILTER_BUILDER,
+    BLOOM_FILTER_PROBE,
     COPY_TO,
     CREATE_MACRO,
     CREATE_SEQUENCE,
@@ -131,7 +133,7 @@ public:
 
     virtual void finalize(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
@@ -24,16 +24,29 @@ struct SemiMaskerLocalState {
 
 class SemiMaskerSharedState {
 public:
-    explicit SemiMaskerSharedState(
-        common::table_id_map_t<std::vector<common::SemiMask*>> masksPerTable)
-        : masksPerTable{std::move(masksPerTable)} {}
+    // A mask selecting more than this fraction of the nodes of a table barely prunes the scan.
+    static constexpr double DENSE_MASK_FRACTION = 0.5;
+
+    SemiMaskerSharedState(common::table_id_map_t<std::vector<common::SemiMask*>> masksPerTable,
+        bool canDisableDenseMasks)
+        : masksPerTable{std::move(masksPerTable)}, canDisableDenseMasks{canDisableDenseMasks} {}
 
     SemiMaskerLocalState* appendLocalState();
 
+    // Merges local masks into the global masks. This happens once the pipeline producing the masks
+    // has finished, so the true number of masked nodes is known. If masks only serve as sideways
+    // information passing into scans, dense masks are disabled and the target scans fall back to
+    // plain scans.
     void mergeToGlobal();
 
+    std::vector<common::table_id_t> getTablesWithDisabledMasks() const {
+        return tablesWithDisabledMasks;
+    }
+
 private:
     common::table_id_map_t<std::vector<common::SemiMask*>> masksPerTable;
+    bool canDisableDenseMasks;
+    std::vector<common::table_id_t> tablesWithDisabledMasks;
     std::vector<std::shared_ptr<SemiMaskerLocalState>> localInfos;
     std::mutex mtx;
 };
@@ -69,6 +82,10 @@ protected:
 
     void finalizeInternal(ExecutionContext* context) final;
 
+public:
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 protected:
     DataPos keyPos;
     common::ValueVector* keyVector;
@@ -84,6 +84,12 @@ public:
     std::unique_ptr<PhysicalOperator> mapAlter(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapAttachDatabase(
         const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapBloomFilterBuilder(
+        const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapBloomFilterProbe(
+        const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapCommonSubplan(
+        const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyFrom(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyNodeFrom(
         const planner::LogicalOperator* logicalOperator);
@@ -228,6 +234,9 @@ public:
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
 
+    // Schedules the materialization of each common subplan before the first pipeline scanning it.
+    void attachCommonSubplans(PhysicalOperator* root);
+
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
     static FactorizedTableSchema createFlatFTableSchema(
@@ -249,7 +258,16 @@ public:
     main::ClientContext* clientContext;
 
 private:
+    // A common subplan is materialized by the first occurrence being mapped. All occurrences scan
+    // the materialized table.
+    struct CommonSubplanState {
+        std::unique_ptr<ResultCollector> resultCollector;
+        std::shared_ptr<FactorizedTable> table;
+        std::vector<PhysicalOperator*> scans;
+    };
+
     std::unordered_map<const planner::LogicalOperator*, PhysicalOperator*> logicalOpToPhysicalOpMap;
+    std::unordered_map<common::idx_t, CommonSubplanState> commonSubplans;
     physical_op_id physicalOperatorID;
     std::vector<extension::MapperExtension*> mapperExtensions;
 };
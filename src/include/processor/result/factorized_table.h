@@ -68,6 +68,13 @@ public:
 
     bool isEmpty() const { return blocks.empty(); }
     const std::vector<std::unique_ptr<DataBlock>>& getBlocks() const { return blocks; }
+    uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->getSizedData().size();
+        }
+        return memoryUsage;
+    }
     DataBlock* getBlock(ft_block_idx_t blockIdx) { return blocks[blockIdx].get(); }
     DataBlock* getLastBlock() { return blocks.back().get(); }
 
@@ -163,6 +170,8 @@ public:
     }
 
     uint64_t getNumTuplesPerBlock() const { return numFlatTuplesPerBlock; }
+    // Number of bytes held by the tuple blocks and overflow buffer of the table.
+    uint64_t getMemoryUsage() const;
 
     bool hasNoNullGuarantee(ft_col_idx_t colIdx) const {
         return tableSchema.getColumn(colIdx)->hasNoNullGuarantee();
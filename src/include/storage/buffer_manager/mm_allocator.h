@@ -42,6 +42,9 @@ public:
     }
 
 private:
+    template<class U, class V>
+    friend bool operator==(const MmAllocator<U>& a, const MmAllocator<V>& b);
+
     MemoryManager* mm;
 };
 
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// Counters describing the work done by the most recent checkpoint. Checkpointing is single
+// threaded, so the counters are not atomic.
+struct CheckpointStats {
+    // Number of CSR node groups skipped because nothing was inserted, deleted or updated in them.
+    uint64_t numCSRNodeGroupsSkipped = 0;
+    // Number of CSR regions rewritten. A region can span multiple leaf regions.
+    uint64_t numCSRRegionsCheckpointed = 0;
+    // Number of bytes of CSR data (including the CSR header) written to disk.
+    uint64_t numCSRBytesWritten = 0;
+
+    void reset() { *this = CheckpointStats{}; }
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -38,6 +38,9 @@ public:
 
     static bool canAutoCheckpoint(const main::ClientContext& clientContext,
         const transaction::Transaction& transaction);
+    // Whether the committed WAL has grown so large that writers should no longer wait for the
+    // background checkpointer.
+    static bool exceedsWALHardLimit(const main::ClientContext& clientContext);
 
 protected:
     virtual bool checkpointStorage();
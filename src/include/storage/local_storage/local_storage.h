@@ -27,12 +27,25 @@ public:
 
     PageAllocator* addOptimisticAllocator();
 
+    // Updates, deletes and COPY modify committed rows in place instead of going through a local
+    // table. Tables modified this way are recorded so that consumers of the transaction's changes,
+    // e.g. materialized views, can tell inserts apart from other changes.
+    void markCommittedRowsChanged(common::table_id_t tableID) {
+        tablesWithCommittedRowChanges.insert(tableID);
+    }
+    bool hasCommittedRowChanges(common::table_id_t tableID) const {
+        return tablesWithCommittedRowChanges.contains(tableID);
+    }
+    // Returns the tables with rows inserted, updated or deleted by the transaction.
+    common::table_id_set_t getChangedTableIDs() const;
+
     void commit();
     void rollback();
 
 private:
     main::ClientContext& clientContext;
     std::unordered_map<common::table_id_t, std::unique_ptr<LocalTable>> tables;
+    common::table_id_set_t tablesWithCommittedRowChanges;
 
     // The mutex is only needed when working with the optimistic allocators
     std::mutex mtx;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
+
+namespace kuzu {
+namespace storage {
+
+// An evenly strided sample of the values appended to a column. When the sample is full, every
+// other value is dropped and the stride is doubled, so the sample stays bounded while still
+// covering all appended values.
+class StridedSample {
+public:
+    void append(double value);
+
+    bool empty() const { return values.empty(); }
+    uint64_t getNumValues() const { return numValues; }
+    const std::vector<double>& getValues() const { return values; }
+    // Number of appended values each sampled value stands for.
+    double getWeight() const {
+        return values.empty() ? 0 : static_cast<double>(numValues) / values.size();
+    }
+
+private:
+    uint64_t numValues = 0;
+    uint64_t stride = 1;
+    std::vector<double> values;
+};
+
+// Equi-depth histogram together with a most-common-value (MCV) list over a numeric or temporal
+// column. Values are mapped to doubles so literals of any supported type can be compared against
+// the bucket bounds. Nulls are not counted; all fractions are relative to non-null values.
+class ColumnHistogram {
+public:
+    struct MostCommonValue {
+        double value = 0;
+        double count = 0;
+
+        void serialize(common::Serializer& serializer) const;
+        static MostCommonValue deserialize(common::Deserializer& deserializer);
+    };
+
+    ColumnHistogram() = default;
+
+    // Builds a histogram from a sample of the non-null values of a column holding numValues
+    // non-null values in total.
+    static ColumnHistogram build(std::vector<double> sample, double numValues,
+        uint64_t numBuckets, uint64_t maxNumMostCommonValues);
+
+    static bool isSupported(const common::LogicalType& type);
+    static std::optional<double> toHistogramValue(const common::Value& value);
+    // Reads a non-null value of a vector of a supported type.
+    static double readValue(const common::ValueVector& vector, common::sel_t pos);
+    // Appends the selected non-null values of the vector to the sample.
+    static void sampleVector(const common::ValueVector& vector, StridedSample& sample);
+
+    double getNumValues() const;
+    uint64_t getNumBuckets() const { return bucketCounts.size(); }
+    uint64_t getNumMostCommonValues() const { return mostCommonValues.size(); }
+
+    // Accounts for newly inserted values. Bucket counts are adjusted in place and out of range
+    // values extend the first or last bucket, so the histogram degrades gracefully until the next
+    // ANALYZE rebuilds it.
+    void insert(const StridedSample& sample);
+
+    // Estimated fraction of non-null values equal to the given value.
+    double estimateEqualsFraction(double value, common::cardinality_t numDistinctValues) const;
+    // Estimated fraction of non-null values smaller than (or equal to, if inclusive) the value.
+    double estimateLessThanFraction(double value, bool inclusive) const;
+    // Estimated selectivity of an equi-join between this column and the other column.
+    double estimateJoinSelectivity(const ColumnHistogram& other,
+        common::cardinality_t numDistinctValues,
+        common::cardinality_t otherNumDistinctValues) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static ColumnHistogram deserialize(common::Deserializer& deserializer);
+
+private:
+    void insert(double value, double count);
+    void compactBuckets();
+    const MostCommonValue* findMostCommonValue(double value) const;
+    double getMostCommonValuesCount() const;
+    double getBucketsCount() const;
+
+private:
+    // Sorted by value.
+    std::vector<MostCommonValue> mostCommonValues;
+    // Bucket i covers [bounds[i], bounds[i + 1]]. Values in the MCV list are not counted.
+    std::vector<double> bounds;
+    std::vector<double> bucketCounts;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -5,6 +5,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
+#include "storage/stats/column_histogram.h"
 #include "storage/stats/hyperloglog.h"
 
 namespace kuzu {
@@ -25,6 +26,17 @@ public:
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
         };
+        if (histogram && !other.insertSample.empty()) {
+            histogram->insert(other.insertSample);
+        }
+    }
+
+    const ColumnHistogram* getHistogram() const {
+        return histogram ? &histogram.value() : nullptr;
+    }
+    void setHistogram(ColumnHistogram newHistogram) {
+        histogram = std::move(newHistogram);
+        insertSample = StridedSample{};
     }
 
     void serialize(common::Serializer& serializer) const {
@@ -34,6 +46,12 @@ public:
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
         }
+        serializer.writeDebuggingInfo("has_histogram");
+        serializer.serializeValue(histogram.has_value());
+        if (histogram) {
+            serializer.writeDebuggingInfo("histogram");
+            histogram->serialize(serializer);
+        }
     }
 
     static ColumnStats deserialize(common::Deserializer& deserializer) {
@@ -46,14 +64,29 @@ public:
             deserializer.validateDebuggingInfo(info, "hll");
             columnStats.hll = HyperLogLog::deserialize(deserializer);
         }
+        deserializer.validateDebuggingInfo(info, "has_histogram");
+        bool hasHistogram = false;
+        deserializer.deserializeValue(hasHistogram);
+        if (hasHistogram) {
+            deserializer.validateDebuggingInfo(info, "histogram");
+            columnStats.histogram = ColumnHistogram::deserialize(deserializer);
+        }
         return columnStats;
     }
 
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    ColumnStats(const ColumnStats& other)
+        : hll{other.hll}, histogram{other.histogram}, insertSample{other.insertSample},
+          hashes{nullptr} {}
 
 private:
     std::optional<HyperLogLog> hll;
+    // Built by ANALYZE. Only present for columns that have been analyzed.
+    std::optional<ColumnHistogram> histogram;
+    // Sample of the values passed to update(). It is folded into the histogram of the stats this
+    // one gets merged into, which keeps histograms approximately up to date across COPY and
+    // inserts.
+    StridedSample insertSample;
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
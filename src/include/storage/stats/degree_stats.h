@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+// Distribution of CSR list lengths (i.e., node degrees) of one direction of a rel table. Degrees
+// are grouped into log2 buckets; bucket i holds nodes with degree in [2^i, 2^(i+1)), and the last
+// bucket also holds all larger degrees. Nodes without rels are not tracked.
+class DegreeStats {
+public:
+    static constexpr common::idx_t NUM_BUCKETS = 32;
+    // The highest-degree nodes that together make up at most this fraction of the nodes with rels
+    // are treated as hubs.
+    static constexpr double HUB_NODES_FRACTION = 0.01;
+
+    void add(common::length_t degree);
+    void remove(common::length_t degree);
+    void merge(const DegreeStats& other);
+
+    bool empty() const { return getNumNodesWithRels() == 0; }
+    uint64_t getNumNodesWithRels() const;
+    uint64_t getNumRels() const;
+
+    // Factor in (0, 1] by which to scale the average degree over numNodes nodes to get the typical
+    // degree of a set of numBoundNodes nodes drawn from them. Hubs skew the average upwards, but a
+    // small set of nodes is unlikely to contain any, so it mostly sees the average degree of the
+    // other nodes. The factor grows towards 1 with the chance of hitting a hub, and is exactly 1
+    // when the distribution is unknown or has no hubs.
+    double getSkewDiscount(common::cardinality_t numBoundNodes,
+        common::cardinality_t numNodes) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStats deserialize(common::Deserializer& deserializer);
+
+private:
+    static common::idx_t getBucketIdx(common::length_t degree);
+
+private:
+    std::array<uint64_t, NUM_BUCKETS> bucketNumNodes{};
+    std::array<uint64_t, NUM_BUCKETS> bucketSumDegrees{};
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -4,6 +4,7 @@
 
 #include "catalog/catalog.h"
 #include "shadow_file.h"
+#include "storage/checkpoint_stats.h"
 #include "storage/index/index.h"
 #include "storage/wal/wal.h"
 
@@ -52,6 +53,7 @@ public:
     bool isReadOnly() const { return readOnly; }
     bool compressionEnabled() const { return enableCompression; }
     bool isInMemory() const { return inMemory; }
+    CheckpointStats& getCheckpointStats() { return checkpointStats; }
 
     void registerIndexType(IndexType indexType) {
         registeredIndexTypes.push_back(std::move(indexType));
@@ -97,6 +99,8 @@ private:
     bool enableCompression;
     bool inMemory;
     std::vector<IndexType> registeredIndexTypes;
+    // Stats of the most recent checkpoint.
+    CheckpointStats checkpointStats;
 };
 
 } // namespace storage
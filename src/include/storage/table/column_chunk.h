@@ -174,6 +174,14 @@ public:
         }
         return memUsage;
     }
+    // Only valid for in-memory chunks that have not been flushed yet.
+    uint64_t getSizeOnDisk() const {
+        uint64_t sizeOnDisk = 0;
+        for (auto& segment : data) {
+            sizeOnDisk += segment->getSizeOnDisk();
+        }
+        return sizeOnDisk;
+    }
     void serialize(common::Serializer& serializer) const;
     static std::unique_ptr<ColumnChunk> deserialize(MemoryManager& mm, common::Deserializer& deSer);
 
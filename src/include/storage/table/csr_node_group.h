@@ -5,7 +5,9 @@
 
 #include "common/constants.h"
 #include "common/system_config.h"
+#include "storage/checkpoint_stats.h"
 #include "storage/enums/csr_node_group_scan_source.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/table/csr_chunked_node_group.h"
 #include "storage/table/node_group.h"
 
@@ -152,11 +154,13 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
     std::unique_ptr<InMemChunkedCSRHeader> oldHeader;
     std::unique_ptr<InMemChunkedCSRHeader> newHeader;
 
+    CheckpointStats& stats;
+
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
-        Column* csrOffsetCol, Column* csrLengthCol)
+        Column* csrOffsetCol, Column* csrLengthCol, CheckpointStats& stats)
         : NodeGroupCheckpointState{std::move(columnIDs), std::move(columns), pageAllocator, mm},
-          csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
+          csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol}, stats{stats} {}
 };
 
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
@@ -214,10 +218,21 @@ public:
     bool isEmpty() const override { return !persistentChunkGroup && NodeGroup::isEmpty(); }
 
     ChunkedNodeGroup* getPersistentChunkedGroup() const { return persistentChunkGroup.get(); }
-    void setPersistentChunkedGroup(std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup) {
+    // `degreeStats` is the distribution of the CSR list lengths of the persistent chunked group.
+    void setPersistentChunkedGroup(std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup,
+        DegreeStats degreeStats_) {
         KU_ASSERT(chunkedNodeGroup->getFormat() == NodeGroupDataFormat::CSR);
+        const auto lock = chunkedGroups.lock();
         persistentChunkGroup = std::move(chunkedNodeGroup);
+        degreeStats = degreeStats_;
+    }
+    // Degree distribution of the persistent data. Changes kept in memory are not reflected until
+    // they are checkpointed.
+    DegreeStats getDegreeStats() const {
+        const auto lock = chunkedGroups.lock();
+        return degreeStats;
     }
+    void setDegreeStats(DegreeStats degreeStats_) { degreeStats = degreeStats_; }
 
     void serialize(common::Serializer& serializer) override;
 
@@ -248,6 +263,10 @@ private:
 
     void checkpointInMemOnly(const common::UniqLock& lock, NodeGroupCheckpointState& state);
     void checkpointInMemAndOnDisk(const common::UniqLock& lock, NodeGroupCheckpointState& state);
+    // Returns true if there are any insertions, deletions or updates to checkpoint. This is a cheap
+    // check that avoids scanning the csr header of unchanged node groups.
+    bool hasChangesToCheckpoint(const common::UniqLock& lock) const;
+    void checkpointWithoutDataChanges(CSRNodeGroupCheckpointState& csrState);
 
     void populateCSRLengthInMemOnly(const common::UniqLock& lock, common::offset_t numNodes,
         const CSRNodeGroupCheckpointState& csrState);
@@ -279,12 +298,15 @@ private:
     std::vector<ChunkCheckpointState> checkpointColumnInRegion(const common::UniqLock& lock,
         common::column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
         const CSRRegion& region) const;
-    void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const;
+    // If `rewriteAll` is false, only the header values of nodes within `regions` are written.
+    void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState,
+        const std::vector<CSRRegion>& regions, bool rewriteAll) const;
     void finalizeCheckpoint(const common::UniqLock& lock);
 
 private:
     std::unique_ptr<ChunkedNodeGroup> persistentChunkGroup;
     std::unique_ptr<CSRIndex> csrIndex;
+    DegreeStats degreeStats;
 };
 
 } // namespace storage
@@ -96,6 +96,10 @@ public:
         auto lock = nodeGroups.lock();
         this->stats.merge(columnIDs, stats);
     }
+    void setHistogram(common::column_id_t columnID, ColumnHistogram histogram) {
+        auto lock = nodeGroups.lock();
+        stats.setHistogram(columnID, std::move(histogram));
+    }
 
     void serialize(common::Serializer& ser);
     void deserialize(common::Deserializer& deSer, MemoryManager& memoryManager);
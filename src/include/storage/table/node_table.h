@@ -203,6 +203,12 @@ public:
     void mergeStats(const std::vector<common::column_id_t>& columnIDs, const TableStats& stats) {
         nodeGroups->mergeStats(columnIDs, stats);
     }
+    // Replaces the histogram of a column. Marks the table as changed so the histogram is persisted
+    // by the next checkpoint.
+    void setHistogram(common::column_id_t columnID, ColumnHistogram histogram) {
+        nodeGroups->setHistogram(columnID, std::move(histogram));
+        hasChanges = true;
+    }
 
     void serialize(common::Serializer& serializer) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
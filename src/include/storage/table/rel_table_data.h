@@ -95,10 +95,12 @@ public:
     common::RelMultiplicity getMultiplicity() const { return multiplicity; }
 
     TableStats getStats() const { return nodeGroups->getStats(); }
+    // Degree distribution of the checkpointed CSR lists over all node groups.
+    DegreeStats getDegreeStats() const;
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
     void checkpoint(const std::vector<common::column_id_t>& columnIDs,
-        PageAllocator& pageAllocator);
+        PageAllocator& pageAllocator, CheckpointStats& stats);
 
     void pushInsertInfo(const transaction::Transaction* transaction, const CSRNodeGroup& nodeGroup,
         common::row_idx_t numRows_, CSRNodeGroupScanSource source);
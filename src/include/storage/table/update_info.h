@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <bitset>
 #include <shared_mutex>
 
 #include "column_chunk_data.h"
@@ -23,6 +24,9 @@ struct VectorUpdateInfo {
     common::transaction_t version;
     std::array<common::sel_t, common::DEFAULT_VECTOR_CAPACITY> rowsInVector;
     common::sel_t numRowsUpdated;
+    // Marks the rows in `rowsInVector`, so that checking whether a row has been updated in this
+    // version doesn't require a linear search, which is quadratic when updating a whole vector.
+    std::bitset<common::DEFAULT_VECTOR_CAPACITY> rowsUpdatedMask;
     // Older versions.
     std::unique_ptr<VectorUpdateInfo> prev;
     // Newer versions.
@@ -72,7 +76,10 @@ public:
 
     UpdateInfo() {}
 
-    VectorUpdateInfo& update(MemoryManager& memoryManager,
+    // Returns the version the row is written to, and whether the version was newly created by this
+    // update. The caller only needs to register a new version with the undo buffer, as commit and
+    // rollback operate on the whole version rather than on individual rows.
+    std::pair<VectorUpdateInfo*, bool> update(MemoryManager& memoryManager,
         const transaction::Transaction* transaction, common::idx_t vectorIdx,
         common::sel_t rowIdxInVector, const common::ValueVector& values);
 
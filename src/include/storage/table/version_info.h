@@ -30,6 +30,10 @@ public:
         common::row_idx_t numRows) const;
 
     void clearVectorInfo(common::idx_t vectorIdx);
+    // Collapses versions of vectors covering the given rows once no active transaction can observe
+    // their older versions. Vectors whose rows are visible to all transactions are dropped, so
+    // scans skip version checks for them entirely. Returns true if no vector has versions left.
+    bool garbageCollect(common::row_idx_t startRow, common::row_idx_t numRows);
 
     bool hasDeletions() const;
     common::row_idx_t getNumDeletions(const transaction::Transaction* transaction,
@@ -92,6 +92,9 @@ public:
 
     void commit(common::transaction_t commitTS) const;
     void rollback(main::ClientContext* context) const;
+    // Collapses versions of rows inserted or deleted by this transaction. Should only be called
+    // after commit when there is no other active transaction in the system.
+    void garbageCollectVersions() const;
 
 private:
     uint8_t* createUndoRecord(uint64_t size);
@@ -116,6 +119,8 @@ private:
     static void rollbackVersionInfo(main::ClientContext* context, UndoRecordType recordType,
         const uint8_t* record);
 
+    static void garbageCollectVersionInfo(const uint8_t* record);
+
     static void commitVectorUpdateInfo(const uint8_t* record, common::transaction_t commitTS);
     static void rollbackVectorUpdateInfo(const uint8_t* record);
 
@@ -7,6 +7,7 @@ namespace binder {
 struct BoundAlterInfo;
 } // namespace binder
 namespace common {
+class BufferWriter;
 class InMemFileWriter;
 class ValueVector;
 } // namespace common
@@ -15,12 +16,20 @@ class CatalogEntry;
 } // namespace catalog
 
 namespace storage {
+
+struct WALCompressionStats {
+    // Number of bytes of WAL records as serialized.
+    uint64_t numBytesBeforeCompression = 0;
+    // Number of bytes of WAL records as written to the WAL, after compressing large records.
+    uint64_t numBytesAfterCompression = 0;
+};
+
 class WAL;
 class LocalWAL {
     friend class WAL;
 
 public:
-    explicit LocalWAL(MemoryManager& mm, bool enableChecksums);
+    LocalWAL(MemoryManager& mm, bool enableChecksums, bool enableCompression);
 
     void logCreateCatalogEntryRecord(catalog::CatalogEntry* catalogEntry, bool isInternal);
     void logDropCatalogEntryRecord(uint64_t tableID, catalog::CatalogEntryType type);
@@ -48,14 +57,25 @@ public:
 
     void clear();
     uint64_t getSize();
+    WALCompressionStats getCompressionStats();
 
 private:
     void addNewWALRecord(const WALRecord& walRecord);
+    // Writes the serialized record wrapped in a compressed record if that is worth it.
+    bool tryWriteCompressed(const uint8_t* data, uint64_t size);
 
 private:
     std::mutex mtx;
     std::shared_ptr<common::InMemFileWriter> inMemWriter;
     common::Serializer serializer;
+    // Records are first serialized here when compression is enabled, so that large records can be
+    // compressed before being written to the WAL.
+    bool enableCompression;
+    std::shared_ptr<common::BufferWriter> recordWriter;
+    common::Serializer recordSerializer;
+    // Reused across records to hold the compressed bytes.
+    std::vector<uint8_t> compressionBuffer;
+    WALCompressionStats compressionStats;
 };
 
 } // namespace storage
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storage/wal/local_wal.h"
 #include "storage/wal/wal_record.h"
 
 namespace kuzu {
@@ -9,7 +10,6 @@ class VirtualFileSystem;
 } // namespace common
 
 namespace storage {
-class LocalWAL;
 class WAL {
 public:
     WAL(const std::string& dbPath, bool readOnly, bool enableChecksums,
@@ -25,6 +25,8 @@ public:
     void reset();
 
     uint64_t getFileSize();
+    // Bytes of the committed WAL records before and after compression since the database opened.
+    WALCompressionStats getCompressionStats();
 
     static WAL* Get(const main::ClientContext& context);
 
@@ -47,6 +49,7 @@ private:
     // writing COMMIT/CHECKPOINT records
     std::unique_ptr<common::Serializer> serializer;
     bool enableChecksums;
+    WALCompressionStats compressionStats;
 };
 
 } // namespace storage
@@ -36,6 +36,8 @@ enum class WALRecordType : uint8_t {
     REL_DETACH_DELETE_RECORD = 34,
     REL_UPDATE_RECORD = 35,
 
+    COMPRESSED_RECORD = 50,
+
     LOAD_EXTENSION_RECORD = 100,
 
     CHECKPOINT_RECORD = 254,
@@ -337,5 +339,22 @@ struct LoadExtensionRecord final : WALRecord {
     static std::unique_ptr<LoadExtensionRecord> deserialize(common::Deserializer& deserializer);
 };
 
+// Wraps the LZ4-compressed serialization of another record. It only exists in the serialized WAL,
+// as deserializing it returns the wrapped record.
+struct CompressedRecord final : WALRecord {
+    uint64_t uncompressedSize;
+    uint64_t compressedSize;
+    const uint8_t* compressedData;
+
+    CompressedRecord(uint64_t uncompressedSize, uint64_t compressedSize,
+        const uint8_t* compressedData)
+        : WALRecord{WALRecordType::COMPRESSED_RECORD}, uncompressedSize{uncompressedSize},
+          compressedSize{compressedSize}, compressedData{compressedData} {}
+
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<WALRecord> deserialize(common::Deserializer& deserializer,
+        const main::ClientContext& clientContext);
+};
+
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace main {
+class Database;
+} // namespace main
+
+namespace transaction {
+
+// Runs auto checkpoints on a background thread, so that the transaction whose commit pushes the WAL
+// past the checkpoint threshold doesn't pay for the checkpoint itself. A checkpoint is attempted
+// once the WAL exceeds the threshold, or once the database has been idle (no commits) for a while
+// after some commits. Checkpoints are only attempted when no transaction is active, so busy
+// workloads can keep the checkpointer from running; commits then fall back to checkpointing inline
+// once the WAL grows past a hard limit (see Checkpointer::exceedsWALHardLimit).
+class BackgroundCheckpointer {
+public:
+    explicit BackgroundCheckpointer(main::Database& database);
+    DELETE_COPY_AND_MOVE(BackgroundCheckpointer);
+    ~BackgroundCheckpointer();
+
+    // Called by each write transaction after it commits. The background thread is started lazily on
+    // the first call.
+    void notifyCommit(bool walExceedsThreshold);
+    // Stops the background thread and waits for an ongoing checkpoint to finish.
+    void stop();
+
+private:
+    void run();
+    bool tryCheckpoint() const;
+
+private:
+    main::Database& database;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::thread thread;
+    bool stopped;
+    // Commits are counted so that notifications arriving while a checkpoint is running are not
+    // lost when the checkpoint finishes.
+    uint64_t numCommits;
+    uint64_t numCommitsCheckpointed;
+    uint64_t numCommitsWhenThresholdExceeded;
+    std::chrono::steady_clock::time_point lastCommitTime;
+};
+
+} // namespace transaction
+} // namespace kuzu
@@ -117,6 +117,7 @@ public:
 
     void commit(storage::WAL* wal);
     void rollback(storage::WAL* wal);
+    void garbageCollectVersions() const;
 
     storage::LocalStorage* getLocalStorage() const { return localStorage.get(); }
     LocalCacheManager& getLocalCacheManager() { return localCacheManager; }
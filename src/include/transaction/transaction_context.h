@@ -56,6 +56,7 @@ public:
 
 private:
     void beginTransactionInternal(TransactionType transactionType);
+    void maintainMaterializedViews();
 
 private:
     std::mutex mtx;
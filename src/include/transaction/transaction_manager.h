@@ -7,11 +7,13 @@
 #include "common/uniq_lock.h"
 #include "storage/checkpointer.h"
 #include "storage/wal/wal.h"
+#include "transaction/background_checkpointer.h"
 #include "transaction/transaction.h"
 
 namespace kuzu {
 namespace main {
 class ClientContext;
+class Database;
 } // namespace main
 
 namespace testing {
@@ -45,6 +47,23 @@ public:
     void rollback(main::ClientContext& clientContext, Transaction* transaction);
 
     void checkpoint(main::ClientContext& clientContext);
+    // Checkpoints only if there are no active transactions instead of waiting for them to leave.
+    // Returns whether the checkpoint happened.
+    bool tryCheckpoint(main::ClientContext& clientContext);
+
+    void initBackgroundCheckpointer(main::Database& database) {
+        backgroundCheckpointer = std::make_unique<BackgroundCheckpointer>(database);
+    }
+    bool hasBackgroundCheckpointer() const { return backgroundCheckpointer != nullptr; }
+    void stopBackgroundCheckpointer() const {
+        if (backgroundCheckpointer) {
+            backgroundCheckpointer->stop();
+        }
+    }
+
+    // Returns the commit timestamp of the last transaction that changed rows of the table, or 0
+    // if no such transaction committed since the database was opened.
+    common::transaction_t getLastCommitTS(common::table_id_t tableID);
 
     static TransactionManager* Get(const main::ClientContext& context);
 
@@ -74,9 +93,14 @@ private:
     // function, which needs to let calls to coming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
+    // Guards tableLastCommitTS separately, so that reading it does not wait for checkpoints.
+    std::mutex mtxForTableCommitTS;
+    common::table_id_map_t<common::transaction_t> tableLastCommitTS;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
 
     init_checkpointer_func_t initCheckpointerFunc;
+    // Only set for on-disk databases that can be written to.
+    std::unique_ptr<BackgroundCheckpointer> backgroundCheckpointer;
 };
 } // namespace transaction
 } // namespace kuzu
@@ -15,6 +15,10 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/query_result/materialized_query_result.h"
+#include "main/result_cache.h"
+#include "optimizer/logical_operator_collector.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
@@ -22,6 +26,7 @@
 #include "planner/planner.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "processor/result/factorized_table.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
@@ -284,6 +289,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_
     }
     auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
         true /*shouldCommitNewTransaction*/, std::move(inputParamsTmp));
+    cachedStatement->normalizedQuery = PlanCache::normalizeQuery(query);
     preparedStatement->cachedPreparedStatementName =
         cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
     useInternalCatalogEntry_ = false;
@@ -328,12 +334,36 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
-    // rebind
+    const auto planCache = localDatabase->getPlanCache();
+    const auto catalogVersion = localDatabase->getCatalog()->getVersion();
+    const auto planCacheKey =
+        getPlanCacheKey(cachedStatement->normalizedQuery, preparedStatement->parameterMap);
+    const auto resultCacheKey =
+        getResultCacheKey(cachedStatement->normalizedQuery, preparedStatement->parameterMap, {});
+    const auto resultCacheGeneration = localDatabase->getResultCache()->getGeneration();
+    if (!resultCacheKey.empty()) {
+        if (auto result = lookupResultCache(resultCacheKey, catalogVersion)) {
+            useInternalCatalogEntry_ = false;
+            return result;
+        }
+    }
+    const auto planCacheEntry =
+        planCacheKey.empty() ? nullptr : planCache->lookup(planCacheKey, catalogVersion);
+    // rebind on a plan cache miss
     auto [newPreparedStatement, newCachedStatement] =
-        prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
-            preparedStatement->parameterMap);
+        planCacheEntry ? prepareFromPlanCache(*planCacheEntry) :
+                         prepareNoLock(cachedStatement->parsedStatement,
+                             false /*shouldCommitNewTransaction*/, preparedStatement->parameterMap);
+    if (planCacheEntry == nullptr && !planCacheKey.empty()) {
+        addToPlanCache(planCacheKey, catalogVersion, *newPreparedStatement, *newCachedStatement);
+    }
     useInternalCatalogEntry_ = false;
-    return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    auto result = executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    if (!resultCacheKey.empty()) {
+        addToResultCache(resultCacheKey, catalogVersion, resultCacheGeneration,
+            *newCachedStatement, *result);
+    }
+    return result;
 }
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
@@ -344,6 +374,40 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
 
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    const auto planCache = localDatabase->getPlanCache();
+    // Read before binding, so that a concurrent catalog change can only make us cache a plan under
+    // an outdated version, which is never looked up again.
+    const auto catalogVersion = localDatabase->getCatalog()->getVersion();
+    std::string planCacheKey, resultCacheKey;
+    if (!query.empty()) {
+        const auto normalizedQuery = PlanCache::normalizeQuery(query);
+        planCacheKey = getPlanCacheKey(normalizedQuery, {} /*params*/);
+        resultCacheKey = getResultCacheKey(normalizedQuery, {} /*params*/, config);
+    }
+    if (!resultCacheKey.empty()) {
+        if (auto queryResult = lookupResultCache(resultCacheKey, catalogVersion)) {
+            return queryResult;
+        }
+    }
+    // Read before the query's transaction starts, see ResultCache::getGeneration().
+    const auto resultCacheGeneration = localDatabase->getResultCache()->getGeneration();
+    if (!planCacheKey.empty()) {
+        auto lookupTimer = TimeMetric(true /* enable */);
+        lookupTimer.start();
+        if (const auto entry = planCache->lookup(planCacheKey, catalogVersion)) {
+            auto [preparedStatement, cachedStatement] = prepareFromPlanCache(*entry);
+            lookupTimer.stop();
+            preparedStatement->preparedSummary.compilingTime = lookupTimer.getElapsedTimeMS();
+            auto queryResult =
+                executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+            useInternalCatalogEntry_ = false;
+            if (!resultCacheKey.empty()) {
+                addToResultCache(resultCacheKey, catalogVersion, resultCacheGeneration,
+                    *cachedStatement, *queryResult);
+            }
+            return queryResult;
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -356,8 +420,15 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
+        if (!planCacheKey.empty() && parsedStatements.size() == 1) {
+            addToPlanCache(planCacheKey, catalogVersion, *preparedStatement, *cachedStatement);
+        }
         auto currentQueryResult =
             executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+        if (!resultCacheKey.empty() && parsedStatements.size() == 1) {
+            addToResultCache(resultCacheKey, catalogVersion, resultCacheGeneration,
+                *cachedStatement, *currentQueryResult);
+        }
         if (!currentQueryResult->isSuccess()) {
             if (!lastResult) {
                 queryResult = std::move(currentQueryResult);
@@ -467,9 +538,25 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 preparedStatement->unknownParameters = expressionBinder->getUnknownParameters();
                 preparedStatement->parameterMap = expressionBinder->getKnownParameters();
                 cachedStatement->columns = boundStatement->getStatementResult()->getColumns();
+                auto planningTimer = TimeMetric(true /* enable */);
+                planningTimer.start();
                 auto planner = Planner(this);
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
+                planningTimer.stop();
+                preparedStatement->preparedSummary.planningTime =
+                    planningTimer.getElapsedTimeMS();
+                auto tableFunctionCallCollector = optimizer::LogicalTableFunctionCallCollector();
+                tableFunctionCallCollector.collect(bestPlan.getLastOperator().get());
+                // Table functions and some folded functions (e.g. current_date()) capture or
+                // change state at bind time, so such plans are not shared.
+                cachedStatement->isPlanCacheable =
+                    preparedStatement->isReadOnly() && !parsedStatement->isInternal() &&
+                    preparedStatement->getStatementType() == StatementType::QUERY &&
+                    !expressionBinder->hasFoldedBindTimeFunction() &&
+                    !tableFunctionCallCollector.hasOperators();
+                cachedStatement->isResultCacheable =
+                    cachedStatement->isPlanCacheable && !expressionBinder->hasRandomFunction();
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
             },
             preparedStatement->isReadOnly(),
@@ -486,6 +573,111 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
     return {std::move(preparedStatement), std::move(cachedStatement)};
 }
 
+std::string ClientContext::getPlanCacheKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params) const {
+    if (getDBConfig()->planCacheSize == 0) {
+        return "";
+    }
+    return getQueryCacheKey(normalizedQuery, params);
+}
+
+std::string ClientContext::getResultCacheKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params,
+    const QueryConfig& config) const {
+    if (getDBConfig()->resultCacheSize == 0 || config.resultType != QueryResultType::FTABLE) {
+        return "";
+    }
+    return getQueryCacheKey(normalizedQuery, params);
+}
+
+std::string ClientContext::getQueryCacheKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params) const {
+    // Plans bound in a manual transaction may see uncommitted catalog changes, and plans of other
+    // databases are not covered by the local catalog version.
+    if (normalizedQuery.empty() || transactionContext->hasActiveTransaction() ||
+        useInternalCatalogEntry_ ||
+        remoteDatabase != nullptr || localDatabase->databaseManager->hasDefaultDatabase()) {
+        return "";
+    }
+    // Settings that change how a query is bound or planned.
+    auto settingsKey = std::to_string(clientConfig.enableSemiMask) +
+                       std::to_string(clientConfig.enableZoneMap) +
+                       std::to_string(clientConfig.disableMapKeyCheck) +
+                       std::to_string(clientConfig.enablePlanOptimizer) +
+                       std::to_string(clientConfig.enableInternalCatalog);
+    settingsKey += "|" + std::to_string(clientConfig.varLengthMaxDepth) + "|" +
+                   PathSemanticUtils::toString(clientConfig.recursivePatternSemantic) + "|" +
+                   std::to_string(clientConfig.recursivePatternCardinalityScaleFactor);
+    return normalizedQuery + '\0' + PlanCache::getParametersKey(params) + '\0' + settingsKey;
+}
+
+ClientContext::PrepareResult ClientContext::prepareFromPlanCache(const PlanCacheEntry& entry) {
+    auto preparedStatement = std::make_unique<PreparedStatement>();
+    preparedStatement->preparedSummary.statementType = entry.parsedStatement->getStatementType();
+    for (auto& [name, value] : entry.parameterMap) {
+        preparedStatement->parameterMap.insert({name, std::make_shared<Value>(*value)});
+    }
+    auto cachedStatement = std::make_unique<CachedPreparedStatement>();
+    cachedStatement->parsedStatement = entry.parsedStatement;
+    cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(entry.logicalPlan.copy());
+    cachedStatement->columns = entry.columns;
+    cachedStatement->isPlanCacheable = true;
+    cachedStatement->isResultCacheable = entry.isResultCacheable;
+    return {std::move(preparedStatement), std::move(cachedStatement)};
+}
+
+void ClientContext::addToPlanCache(const std::string& key, uint64_t catalogVersion,
+    const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+    if (!preparedStatement.isSuccess() || !cachedStatement.isPlanCacheable ||
+        !preparedStatement.getUnknownParameters().empty()) {
+        return;
+    }
+    auto entry = std::make_shared<PlanCacheEntry>();
+    entry->parsedStatement = cachedStatement.parsedStatement;
+    entry->logicalPlan = cachedStatement.logicalPlan->copy();
+    entry->columns = cachedStatement.columns;
+    entry->isResultCacheable = cachedStatement.isResultCacheable;
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        entry->parameterMap.insert({name, std::make_shared<Value>(*value)});
+    }
+    localDatabase->getPlanCache()->insert(key, catalogVersion, std::move(entry));
+}
+
+std::unique_ptr<QueryResult> ClientContext::lookupResultCache(const std::string& key,
+    uint64_t catalogVersion) const {
+    auto lookupTimer = TimeMetric(true /* enable */);
+    lookupTimer.start();
+    const auto entry = localDatabase->getResultCache()->lookup(key, catalogVersion);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    auto result = std::make_unique<MaterializedQueryResult>(entry->columnNames,
+        LogicalType::copy(entry->columnTypes), entry->table);
+    lookupTimer.stop();
+    auto preparedSummary = PreparedSummary();
+    preparedSummary.compilingTime = lookupTimer.getElapsedTimeMS();
+    preparedSummary.statementType = StatementType::QUERY;
+    result->setQuerySummary(std::make_unique<QuerySummary>(preparedSummary));
+    return result;
+}
+
+void ClientContext::addToResultCache(const std::string& key, uint64_t catalogVersion,
+    uint64_t generation, const CachedPreparedStatement& cachedStatement,
+    const QueryResult& queryResult) const {
+    if (!cachedStatement.isResultCacheable || !queryResult.isSuccess() ||
+        queryResult.getType() != QueryResultType::FTABLE) {
+        return;
+    }
+    auto entry = std::make_shared<ResultCacheEntry>();
+    entry->columnNames = cachedStatement.getColumnNames();
+    entry->columnTypes = cachedStatement.getColumnTypes();
+    entry->table = queryResult.constCast<MaterializedQueryResult>().getSharedFactorizedTable();
+    entry->collectTables(*cachedStatement.logicalPlan);
+    entry->memoryUsage = entry->table->getMemoryUsage();
+    localDatabase->getResultCache()->insert(key, catalogVersion, generation, std::move(entry));
+}
+
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
     QueryConfig queryConfig) {
@@ -544,6 +736,24 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return result;
 }
 
+std::unique_ptr<QueryResult> ClientContext::executeBoundQueryNoLock(
+    const BoundStatement& boundStatement) {
+    KU_ASSERT(transactionContext->hasActiveTransaction());
+    auto preparedStatement = std::make_unique<PreparedStatement>();
+    preparedStatement->preparedSummary.statementType = StatementType::QUERY;
+    auto cachedStatement = std::make_unique<CachedPreparedStatement>();
+    try {
+        cachedStatement->columns = boundStatement.getStatementResult()->getColumns();
+        auto planner = Planner(this);
+        auto bestPlan = planner.planStatement(boundStatement);
+        optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
+        cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
+    } catch (std::exception& exception) {
+        return QueryResult::getQueryResultWithError(exception.what());
+    }
+    return executeNoLock(preparedStatement.get(), cachedStatement.get());
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     const auto memoryManager = storage::MemoryManager::Get(*this);
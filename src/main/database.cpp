@@ -7,6 +7,9 @@
 #include "extension/transformer_extension.h"
 #include "main/client_context.h"
 #include "main/database_manager.h"
+#include "main/materialized_view.h"
+#include "main/plan_cache.h"
+#include "main/result_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 #if defined(_WIN32)
@@ -121,6 +124,8 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
 #endif
 
     catalog = std::make_unique<Catalog>();
+    planCache = std::make_unique<PlanCache>(dbConfig.planCacheSize);
+    resultCache = std::make_unique<ResultCache>(dbConfig.resultCacheSize);
     storageManager = std::make_unique<StorageManager>(databasePath, dbConfig.readOnly,
         dbConfig.enableChecksums, *memoryManager, dbConfig.enableCompression, vfs.get());
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
@@ -135,9 +140,21 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     }
     StorageManager::recover(clientContext, dbConfig.throwOnWalReplayFailure,
         dbConfig.enableChecksums);
+    // Materialized view definitions are built into the database rather than an extension, so they
+    // are loaded eagerly to keep writes to their base tables unblocked.
+    for (auto indexEntry : catalog->getIndexEntries(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        if (MaterializedViewCatalogEntry::isMaterializedView(*indexEntry)) {
+            MaterializedViewCatalogEntry::getAuxInfo(*indexEntry);
+        }
+    }
+    // In-memory databases have no WAL or data file to checkpoint to, so they never get one.
+    if (!dbConfig.readOnly && !DBConfig::isDBPathInMemory(databasePath)) {
+        transactionManager->initBackgroundCheckpointer(*this);
+    }
 }
 
 Database::~Database() {
+    transactionManager->stopBackgroundCheckpointer();
     if (!dbConfig.readOnly && dbConfig.forceCheckpointOnClose) {
         try {
             ClientContext clientContext(this);
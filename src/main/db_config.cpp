@@ -1,5 +1,6 @@
 #include "main/db_config.h"
 
+#include "common/constants.h"
 #include "common/string_utils.h"
 #include "main/database.h"
 #include "main/settings.h"
@@ -22,7 +23,10 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskSetting),
-    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting)};
+    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting),
+    GET_CONFIGURATION(WALCompressionSetting), GET_CONFIGURATION(BackgroundCheckpointSetting),
+    GET_CONFIGURATION(PlanCacheSizeSetting), GET_CONFIGURATION(ResultCacheSizeSetting),
+    GET_CONFIGURATION(WSPBucketWidthSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
@@ -32,7 +36,9 @@ DBConfig::DBConfig(const SystemConfig& systemConfig)
       checkpointThreshold{systemConfig.checkpointThreshold},
       forceCheckpointOnClose{systemConfig.forceCheckpointOnClose},
       throwOnWalReplayFailure(systemConfig.throwOnWalReplayFailure),
-      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true} {
+      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true},
+      enableWALCompression{false}, backgroundCheckpoint{false},
+      planCacheSize{DEFAULT_PLAN_CACHE_SIZE}, resultCacheSize{DEFAULT_RESULT_CACHE_SIZE} {
 #if defined(__APPLE__)
     this->threadQos = systemConfig.threadQos;
 #endif
@@ -0,0 +1,506 @@
+#include "main/materialized_view.h"
+
+#include "binder/binder.h"
+#include "binder/expression/aggregate_function_expression.h"
+#include "binder/expression/node_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "binder/expression_visitor.h"
+#include "binder/query/bound_regular_query.h"
+#include "binder/query/reading_clause/bound_match_clause.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate/count_star.h"
+#include "function/aggregate_function.h"
+#include "function/schema/vector_node_rel_functions.h"
+#include "main/client_context.h"
+#include "parser/parser.h"
+#include "processor/result/flat_tuple.h"
+#include "storage/local_storage/local_storage.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace main {
+
+bool MaterializedViewAuxInfo::isIncrementallyMaintainable() const {
+    return std::ranges::none_of(columnKinds,
+        [](auto kind) { return kind == MaterializedViewColumnKind::OTHER; });
+}
+
+std::shared_ptr<BufferWriter> MaterializedViewAuxInfo::serialize() const {
+    auto bufferWriter = std::make_shared<BufferWriter>();
+    auto serializer = Serializer(bufferWriter);
+    serializer.serializeValue(query);
+    serializer.serializeVector(columnKinds);
+    serializer.serializeVector(baseTableIDs);
+    return bufferWriter;
+}
+
+std::unique_ptr<MaterializedViewAuxInfo> MaterializedViewAuxInfo::deserialize(
+    std::unique_ptr<BufferReader> reader) {
+    Deserializer deserializer{std::move(reader)};
+    std::string query;
+    std::vector<MaterializedViewColumnKind> columnKinds;
+    std::vector<table_id_t> baseTableIDs;
+    deserializer.deserializeValue(query);
+    deserializer.deserializeVector(columnKinds);
+    deserializer.deserializeVector(baseTableIDs);
+    return std::make_unique<MaterializedViewAuxInfo>(std::move(query), std::move(columnKinds),
+        std::move(baseTableIDs));
+}
+
+std::string MaterializedViewAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
+    const ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<IndexToCypherInfo>();
+    auto tableEntry = Catalog::Get(*indexToCypherInfo.context)
+                          ->getTableCatalogEntry(Transaction::Get(*indexToCypherInfo.context),
+                              indexEntry.getTableID());
+    return stringFormat("CALL _CREATE_MATERIALIZED_VIEW('{}', '{}');",
+        MaterializedViewCatalogEntry::escapeStringLiteral(tableEntry->getName()),
+        MaterializedViewCatalogEntry::escapeStringLiteral(query));
+}
+
+const MaterializedViewAuxInfo& MaterializedViewCatalogEntry::getAuxInfo(
+    IndexCatalogEntry& indexEntry) {
+    KU_ASSERT(isMaterializedView(indexEntry));
+    if (!indexEntry.isLoaded()) {
+        indexEntry.setAuxInfo(
+            MaterializedViewAuxInfo::deserialize(indexEntry.getAuxBufferReader()));
+    }
+    return indexEntry.getAuxInfo().cast<MaterializedViewAuxInfo>();
+}
+
+IndexCatalogEntry* MaterializedViewCatalogEntry::getViewReferencing(const Catalog& catalog,
+    const Transaction* transaction, table_id_t tableID) {
+    for (auto indexEntry : catalog.getIndexEntries(transaction)) {
+        if (!isMaterializedView(*indexEntry)) {
+            continue;
+        }
+        auto& baseTableIDs = getAuxInfo(*indexEntry).baseTableIDs;
+        if (std::ranges::find(baseTableIDs, tableID) != baseTableIDs.end()) {
+            return indexEntry;
+        }
+    }
+    return nullptr;
+}
+
+IndexCatalogEntry* MaterializedViewCatalogEntry::getViewOfTable(const Catalog& catalog,
+    const Transaction* transaction, table_id_t tableID) {
+    for (auto indexEntry : catalog.getIndexEntries(transaction, tableID)) {
+        if (isMaterializedView(*indexEntry)) {
+            return indexEntry;
+        }
+    }
+    return nullptr;
+}
+
+std::string MaterializedViewCatalogEntry::escapeStringLiteral(const std::string& str) {
+    std::string result;
+    for (auto c : str) {
+        if (c == '\\' || c == '\'') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+static std::unique_ptr<BoundStatement> bindQuery(Binder& binder, const std::string& query) {
+    auto statements = parser::Parser::parseQuery(query);
+    if (statements.size() != 1 || statements[0]->getStatementType() != StatementType::QUERY) {
+        throw BinderException("The query of a materialized view must be a single query.");
+    }
+    return binder.bind(*statements[0]);
+}
+
+static BoundMatchClause& getMatchClause(BoundStatement& statement) {
+    auto& query = statement.cast<BoundRegularQuery>();
+    return query.getSingleQueryUnsafe(0)
+        ->getQueryPartUnsafe(0)
+        ->getReadingClause(0)
+        ->cast<BoundMatchClause>();
+}
+
+static void validateNoSubquery(const std::shared_ptr<Expression>& expression) {
+    auto collector = SubqueryExprCollector();
+    collector.visit(expression);
+    if (collector.hasSubquery()) {
+        throw BinderException("The query of a materialized view cannot contain subqueries.");
+    }
+}
+
+static MaterializedViewColumnKind getColumnKind(const Expression& expression) {
+    if (expression.expressionType != ExpressionType::AGGREGATE_FUNCTION) {
+        return MaterializedViewColumnKind::OTHER;
+    }
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    if (aggregate.isDistinct()) {
+        return MaterializedViewColumnKind::OTHER;
+    }
+    auto& name = aggregate.getFunction().name;
+    if (name == function::CountFunction::name || name == function::CountStarFunction::name) {
+        return MaterializedViewColumnKind::COUNT;
+    }
+    if (name == function::AggregateSumFunction::name) {
+        return MaterializedViewColumnKind::SUM;
+    }
+    if (name == function::AggregateMinFunction::name) {
+        return MaterializedViewColumnKind::MIN;
+    }
+    if (name == function::AggregateMaxFunction::name) {
+        return MaterializedViewColumnKind::MAX;
+    }
+    return MaterializedViewColumnKind::OTHER;
+}
+
+MaterializedViewDefinition MaterializedViewDefinition::bind(ClientContext& context,
+    const std::string& query) {
+    auto binder = Binder(&context);
+    auto boundStatement = bindQuery(binder, query);
+    auto& regularQuery = boundStatement->constCast<BoundRegularQuery>();
+    if (regularQuery.getNumSingleQueries() != 1 ||
+        regularQuery.getSingleQuery(0)->getNumQueryParts() != 1) {
+        throw BinderException(
+            "The query of a materialized view cannot contain UNION or WITH clauses.");
+    }
+    auto queryPart = regularQuery.getSingleQuery(0)->getQueryPart(0);
+    if (queryPart->getNumReadingClause() != 1 ||
+        queryPart->getReadingClause(0)->getClauseType() != ClauseType::MATCH ||
+        queryPart->hasUpdatingClause() || !queryPart->hasProjectionBody()) {
+        throw BinderException(
+            "The query of a materialized view must consist of a MATCH and a RETURN clause.");
+    }
+    auto& matchClause = queryPart->getReadingClause(0)->constCast<BoundMatchClause>();
+    if (matchClause.getMatchClauseType() != MatchClauseType::MATCH) {
+        throw BinderException("The query of a materialized view cannot contain OPTIONAL MATCH.");
+    }
+    if (matchClause.hasPredicate()) {
+        validateNoSubquery(matchClause.getPredicate());
+    }
+    MaterializedViewDefinition definition;
+    auto addBaseTable = [&](table_id_t tableID) {
+        if (std::ranges::find(definition.baseTableIDs, tableID) ==
+            definition.baseTableIDs.end()) {
+            definition.baseTableIDs.push_back(tableID);
+        }
+    };
+    auto& collection = *matchClause.getQueryGraphCollection();
+    for (auto& node : collection.getQueryNodes()) {
+        if (node->isEmpty() || node->isMultiLabeled()) {
+            throw BinderException(stringFormat(
+                "Node {} of a materialized view must have exactly one label.", node->toString()));
+        }
+        addBaseTable(node->getEntry(0)->getTableID());
+    }
+    for (auto& rel : collection.getQueryRels()) {
+        if (rel->isRecursive()) {
+            throw BinderException(
+                "The query of a materialized view cannot contain recursive relationships.");
+        }
+        if (rel->getNumEntries() != 1) {
+            throw BinderException(stringFormat(
+                "Relationship {} of a materialized view must have exactly one label.",
+                rel->toString()));
+        }
+        addBaseTable(rel->getEntry(0)->getTableID());
+    }
+    auto catalog = Catalog::Get(context);
+    auto transaction = Transaction::Get(context);
+    for (auto tableID : definition.baseTableIDs) {
+        if (MaterializedViewCatalogEntry::getViewOfTable(*catalog, transaction, tableID)) {
+            throw BinderException(
+                "The query of a materialized view cannot read from another materialized view.");
+        }
+    }
+    auto projectionBody = queryPart->getProjectionBody();
+    auto groupByExpressions = projectionBody->getGroupByExpressions();
+    if (projectionBody->isDistinct() || projectionBody->hasOrderByExpressions() ||
+        projectionBody->hasSkipOrLimit() || queryPart->hasProjectionBodyPredicate()) {
+        throw BinderException("The RETURN clause of a materialized view cannot contain DISTINCT, "
+                              "ORDER BY, SKIP or LIMIT.");
+    }
+    auto projectionExpressions = projectionBody->getProjectionExpressions();
+    if (!projectionBody->hasAggregateExpressions() || groupByExpressions.size() != 1 ||
+        groupByExpressions[0]->getUniqueName() != projectionExpressions[0]->getUniqueName()) {
+        throw BinderException("A materialized view must group by its first column and aggregate "
+                              "all other columns.");
+    }
+    auto statementResult = boundStatement->getStatementResult();
+    definition.columnNames = statementResult->getColumnNames();
+    for (auto i = 0u; i < projectionExpressions.size(); i++) {
+        auto& expression = projectionExpressions[i];
+        validateNoSubquery(expression);
+        if (definition.columnNames[i].find('`') != std::string::npos) {
+            throw BinderException(
+                stringFormat("Invalid column name {} for a materialized view.",
+                    definition.columnNames[i]));
+        }
+        definition.columnTypes.push_back(expression->getDataType().copy());
+        definition.columnKinds.push_back(
+            i == 0 ? MaterializedViewColumnKind::KEY : getColumnKind(*expression));
+    }
+    return definition;
+}
+
+// Node tables and the rel tables of rel groups that store the tuples of the given base tables.
+static table_id_set_t getStorageTableIDs(const Catalog& catalog, const Transaction* transaction,
+    const std::vector<table_id_t>& baseTableIDs) {
+    table_id_set_t result;
+    for (auto tableID : baseTableIDs) {
+        auto tableEntry = catalog.getTableCatalogEntry(transaction, tableID);
+        if (tableEntry->getTableType() == TableType::NODE) {
+            result.insert(tableID);
+            continue;
+        }
+        for (auto& info : tableEntry->constCast<RelGroupCatalogEntry>().getRelEntryInfos()) {
+            result.insert(info.oid);
+        }
+    }
+    return result;
+}
+
+void MaterializedViewMaintainer::maintain() {
+    auto catalog = Catalog::Get(context);
+    auto transaction = Transaction::Get(context);
+    // Statements executed by the maintainer reset the flag of the statement being committed.
+    auto useInternalCatalogEntry = context.useInternalCatalogEntry_;
+    for (auto indexEntry : catalog->getIndexEntries(transaction)) {
+        if (MaterializedViewCatalogEntry::isMaterializedView(*indexEntry)) {
+            maintain(*indexEntry);
+        }
+    }
+    context.useInternalCatalogEntry_ = useInternalCatalogEntry;
+}
+
+void MaterializedViewMaintainer::maintain(IndexCatalogEntry& viewEntry) {
+    auto catalog = Catalog::Get(context);
+    auto transaction = Transaction::Get(context);
+    auto localStorage = transaction->getLocalStorage();
+    auto& auxInfo = MaterializedViewCatalogEntry::getAuxInfo(viewEntry);
+    // A view created by this transaction is populated on commit.
+    auto recompute = viewEntry.getTimestamp() == transaction->getID();
+    table_id_set_t insertedTableIDs;
+    for (auto tableID : getStorageTableIDs(*catalog, transaction, auxInfo.baseTableIDs)) {
+        if (localStorage->hasCommittedRowChanges(tableID)) {
+            recompute = true;
+        }
+        auto localTable = localStorage->getLocalTable(tableID);
+        if (localTable != nullptr && localTable->getNumTotalRows() > 0) {
+            insertedTableIDs.insert(tableID);
+        }
+    }
+    auto& viewTableEntry = *catalog->getTableCatalogEntry(transaction, viewEntry.getTableID());
+    if (recompute || (!insertedTableIDs.empty() && !auxInfo.isIncrementallyMaintainable())) {
+        replace(viewTableEntry, evaluate(auxInfo, {} /* insertedTableIDs */));
+    } else if (!insertedTableIDs.empty()) {
+        merge(viewTableEntry, auxInfo, evaluate(auxInfo, insertedTableIDs));
+    }
+}
+
+static std::shared_ptr<Expression> createIsInsertedPredicate(ExpressionBinder& expressionBinder,
+    std::shared_ptr<Expression> internalID, offset_t minInsertedOffset) {
+    auto offset =
+        expressionBinder.bindScalarFunctionExpression({std::move(internalID)},
+            function::OffsetFunction::name);
+    auto minOffset =
+        expressionBinder.createLiteralExpression(Value(static_cast<int64_t>(minInsertedOffset)));
+    return expressionBinder.bindComparisonExpression(ExpressionType::GREATER_THAN_EQUALS,
+        {std::move(offset), std::move(minOffset)});
+}
+
+std::vector<std::vector<Value>> MaterializedViewMaintainer::evaluate(
+    const MaterializedViewAuxInfo& auxInfo, const table_id_set_t& insertedTableIDs) {
+    auto binder = Binder(&context);
+    auto boundStatement = bindQuery(binder, auxInfo.query);
+    if (!insertedTableIDs.empty()) {
+        // A join result is new iff at least one of its tuples is new. Inserted nodes get offsets
+        // after the committed ones and inserted rels get offsets above MAX_NUM_ROWS_IN_TABLE.
+        auto transaction = Transaction::Get(context);
+        auto& expressionBinder = *binder.getExpressionBinder();
+        auto& matchClause = getMatchClause(*boundStatement);
+        std::shared_ptr<Expression> isInserted;
+        for (auto& node : matchClause.getQueryGraphCollection()->getQueryNodes()) {
+            auto tableID = node->getEntry(0)->getTableID();
+            if (insertedTableIDs.contains(tableID)) {
+                isInserted = expressionBinder.combineBooleanExpressions(ExpressionType::OR,
+                    isInserted,
+                    createIsInsertedPredicate(expressionBinder, node->getInternalID(),
+                        transaction->getUncommittedOffset(tableID, 0)));
+            }
+        }
+        for (auto& rel : matchClause.getQueryGraphCollection()->getQueryRels()) {
+            auto& relGroupEntry = rel->getEntry(0)->constCast<RelGroupCatalogEntry>();
+            auto hasInserts = std::ranges::any_of(relGroupEntry.getRelEntryInfos(),
+                [&](auto& info) { return insertedTableIDs.contains(info.oid); });
+            if (hasInserts) {
+                isInserted = expressionBinder.combineBooleanExpressions(ExpressionType::OR,
+                    isInserted,
+                    createIsInsertedPredicate(expressionBinder, rel->getInternalID(),
+                        StorageConstants::MAX_NUM_ROWS_IN_TABLE));
+            }
+        }
+        matchClause.setPredicate(expressionBinder.combineBooleanExpressions(ExpressionType::AND,
+            matchClause.getPredicate(), isInserted));
+    }
+    auto result = context.executeBoundQueryNoLock(*boundStatement);
+    if (!result->isSuccess()) {
+        throw RuntimeException(stringFormat("Failed to evaluate materialized view query: {}",
+            result->getErrorMessage()));
+    }
+    std::vector<std::vector<Value>> rows;
+    while (result->hasNext()) {
+        auto tuple = result->getNext();
+        // Rows without a key cannot be stored in the view table.
+        if (tuple->getValue(0)->isNull()) {
+            continue;
+        }
+        std::vector<Value> row;
+        for (auto i = 0u; i < tuple->len(); i++) {
+            row.push_back(*tuple->getValue(i));
+        }
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+static std::string getRowField(idx_t columnIdx) {
+    return stringFormat("row.c{}", columnIdx);
+}
+
+static std::shared_ptr<Value> createRowsValue(const TableCatalogEntry& viewTableEntry,
+    std::vector<std::vector<Value>> rows) {
+    std::vector<StructField> fields;
+    auto properties = viewTableEntry.getProperties();
+    for (auto i = 0u; i < properties.size(); i++) {
+        fields.emplace_back(stringFormat("c{}", i), properties[i].getType().copy());
+    }
+    auto rowType = LogicalType::STRUCT(std::move(fields));
+    std::vector<std::unique_ptr<Value>> rowValues;
+    for (auto& row : rows) {
+        std::vector<std::unique_ptr<Value>> fieldValues;
+        for (auto& value : row) {
+            fieldValues.push_back(std::make_unique<Value>(std::move(value)));
+        }
+        rowValues.push_back(std::make_unique<Value>(rowType.copy(), std::move(fieldValues)));
+    }
+    return std::make_shared<Value>(LogicalType::LIST(std::move(rowType)), std::move(rowValues));
+}
+
+void MaterializedViewMaintainer::merge(const TableCatalogEntry& viewTableEntry,
+    const MaterializedViewAuxInfo& auxInfo, std::vector<std::vector<Value>> rows) {
+    if (rows.empty()) {
+        return;
+    }
+    auto properties = viewTableEntry.getProperties();
+    KU_ASSERT(properties.size() == auxInfo.columnKinds.size());
+    std::string onCreate, onMatch;
+    for (auto i = 1u; i < properties.size(); i++) {
+        auto column = stringFormat("v.`{}`", properties[i].getName());
+        auto delta = getRowField(i);
+        std::string merged;
+        switch (auxInfo.columnKinds[i]) {
+        case MaterializedViewColumnKind::COUNT: {
+            merged = stringFormat("{} + {}", column, delta);
+        } break;
+        case MaterializedViewColumnKind::SUM: {
+            merged = stringFormat("CASE WHEN {} IS NULL THEN {} WHEN {} IS NULL THEN {} "
+                                  "ELSE {} + {} END",
+                column, delta, delta, column, column, delta);
+        } break;
+        case MaterializedViewColumnKind::MIN: {
+            merged = stringFormat("CASE WHEN {} IS NULL OR {} < {} THEN {} ELSE {} END", column,
+                delta, column, delta, column);
+        } break;
+        case MaterializedViewColumnKind::MAX: {
+            merged = stringFormat("CASE WHEN {} IS NULL OR {} > {} THEN {} ELSE {} END", column,
+                delta, column, delta, column);
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+        auto separator = i == 1 ? "" : ", ";
+        onCreate += stringFormat("{}{} = {}", separator, column, delta);
+        onMatch += stringFormat("{}{} = {}", separator, column, merged);
+    }
+    auto query = stringFormat("UNWIND $rows AS row MERGE (v:`{}` {`{}`: {}}) ON CREATE SET {} "
+                              "ON MATCH SET {};",
+        viewTableEntry.getName(), properties[0].getName(), getRowField(0), onCreate, onMatch);
+    execute(viewTableEntry.getName(), query,
+        {{"rows", createRowsValue(viewTableEntry, std::move(rows))}});
+}
+
+void MaterializedViewMaintainer::replace(const TableCatalogEntry& viewTableEntry,
+    std::vector<std::vector<Value>> rows) {
+    auto properties = viewTableEntry.getProperties();
+    auto viewName = viewTableEntry.getName();
+    auto keyName = properties[0].getName();
+    // Delete the rows whose key is no longer produced by the query. Looking them up by primary key
+    // keeps the refresh linear in the size of the view.
+    auto binder = Binder(&context);
+    auto keysStatement =
+        bindQuery(binder, stringFormat("MATCH (v:`{}`) RETURN v.`{}`;", viewName, keyName));
+    auto keysResult = context.executeBoundQueryNoLock(*keysStatement);
+    if (!keysResult->isSuccess()) {
+        throw RuntimeException(stringFormat("Failed to maintain materialized view {}: {}",
+            viewName, keysResult->getErrorMessage()));
+    }
+    std::unordered_set<std::string> newKeys;
+    for (auto& row : rows) {
+        newKeys.insert(row[0].toString());
+    }
+    std::vector<std::unique_ptr<Value>> staleKeys;
+    while (keysResult->hasNext()) {
+        auto key = keysResult->getNext()->getValue(0);
+        if (!newKeys.contains(key->toString())) {
+            staleKeys.push_back(std::make_unique<Value>(*key));
+        }
+    }
+    if (!staleKeys.empty()) {
+        auto staleKeysValue = std::make_shared<Value>(
+            LogicalType::LIST(properties[0].getType().copy()), std::move(staleKeys));
+        execute(viewName,
+            stringFormat("UNWIND $keys AS k MATCH (v:`{}` {`{}`: k}) DELETE v;", viewName, keyName),
+            {{"keys", std::move(staleKeysValue)}});
+    }
+    if (rows.empty()) {
+        return;
+    }
+    std::string set;
+    for (auto i = 1u; i < properties.size(); i++) {
+        set += stringFormat("{}v.`{}` = {}", i == 1 ? "" : ", ", properties[i].getName(),
+            getRowField(i));
+    }
+    auto query = stringFormat("UNWIND $rows AS row MERGE (v:`{}` {`{}`: {}}) SET {};", viewName,
+        keyName, getRowField(0), set);
+    execute(viewName, query, {{"rows", createRowsValue(viewTableEntry, std::move(rows))}});
+}
+
+void MaterializedViewMaintainer::execute(const std::string& viewName, const std::string& query,
+    std::unordered_map<std::string, std::shared_ptr<Value>> params) {
+    auto statements = parser::Parser::parseQuery(query);
+    KU_ASSERT(statements.size() == 1);
+    // View tables can only be written by statements that use internal catalog entries.
+    context.useInternalCatalogEntry_ = true;
+    auto [preparedStatement, cachedStatement] =
+        context.prepareNoLock(statements[0], false /*shouldCommitNewTransaction*/,
+            std::move(params));
+    auto result = context.executeNoLock(preparedStatement.get(), cachedStatement.get());
+    if (!result->isSuccess()) {
+        throw RuntimeException(stringFormat("Failed to maintain materialized view {}: {}",
+            viewName, result->getErrorMessage()));
+    }
+}
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,157 @@
+#include "main/plan_cache.h"
+
+#include <algorithm>
+
+#include "common/string_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace main {
+
+std::string PlanCache::normalizeQuery(std::string_view query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = 0;
+    bool pendingSpace = false;
+    for (auto i = 0u; i < query.size(); i++) {
+        const auto c = query[i];
+        if (quote != 0) {
+            result += c;
+            if (c == '\\' && i + 1 < query.size()) {
+                result += query[++i];
+            } else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        // Comments are dropped like whitespace. A line comment runs until the end of the line but
+        // not past it, so the newline still separates the tokens around it.
+        if (c == '/' && i + 1 < query.size() && query[i + 1] == '/') {
+            while (i + 1 < query.size() && query[i + 1] != '\n' && query[i + 1] != '\r') {
+                i++;
+            }
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (c == '/' && i + 1 < query.size() && query[i + 1] == '*') {
+            const auto end = query.find("*/", i + 2);
+            i = end == std::string_view::npos ? query.size() : end + 1;
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (StringUtils::isSpace(c)) {
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            result += ' ';
+            pendingSpace = false;
+        }
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+        result += c;
+    }
+    while (!result.empty() && (result.back() == ';' || result.back() == ' ')) {
+        result.pop_back();
+    }
+    return result;
+}
+
+std::string PlanCache::getParametersKey(
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters) {
+    std::vector<std::string> names;
+    names.reserve(parameters.size());
+    for (auto& [name, _] : parameters) {
+        names.push_back(name);
+    }
+    std::sort(names.begin(), names.end());
+    std::string result;
+    for (auto& name : names) {
+        const auto& value = *parameters.at(name);
+        result += name + ":" + value.getDataType().toString() + "=" + value.toString() + ";";
+    }
+    return result;
+}
+
+std::shared_ptr<const PlanCacheEntry> PlanCache::lookup(const std::string& key,
+    uint64_t catalogVersion_) {
+    std::unique_lock lck{mtx};
+    validateCatalogVersionNoLock(catalogVersion_);
+    const auto it = slots.find(key);
+    if (it == slots.end()) {
+        return nullptr;
+    }
+    numHits++;
+    lruKeys.splice(lruKeys.begin(), lruKeys, it->second.lruPos);
+    return it->second.entry;
+}
+
+void PlanCache::insert(const std::string& key, uint64_t catalogVersion_,
+    std::shared_ptr<const PlanCacheEntry> entry) {
+    std::unique_lock lck{mtx};
+    validateCatalogVersionNoLock(catalogVersion_);
+    numMisses++;
+    if (capacity == 0) {
+        return;
+    }
+    if (const auto it = slots.find(key); it != slots.end()) {
+        it->second.entry = std::move(entry);
+        lruKeys.splice(lruKeys.begin(), lruKeys, it->second.lruPos);
+        return;
+    }
+    lruKeys.push_front(key);
+    slots.emplace(key, Slot{std::move(entry), lruKeys.begin()});
+    evictNoLock();
+}
+
+void PlanCache::setCapacity(uint64_t newCapacity) {
+    std::unique_lock lck{mtx};
+    capacity = newCapacity;
+    evictNoLock();
+}
+
+void PlanCache::clear() {
+    std::unique_lock lck{mtx};
+    if (!slots.empty()) {
+        numInvalidations++;
+    }
+    slots.clear();
+    lruKeys.clear();
+}
+
+PlanCacheStats PlanCache::getStats() const {
+    std::unique_lock lck{mtx};
+    PlanCacheStats stats;
+    stats.numEntries = slots.size();
+    stats.capacity = capacity;
+    stats.numHits = numHits;
+    stats.numMisses = numMisses;
+    stats.numEvictions = numEvictions;
+    stats.numInvalidations = numInvalidations;
+    return stats;
+}
+
+void PlanCache::validateCatalogVersionNoLock(uint64_t catalogVersion_) {
+    if (catalogVersion_ == catalogVersion) {
+        return;
+    }
+    if (!slots.empty()) {
+        numInvalidations++;
+    }
+    slots.clear();
+    lruKeys.clear();
+    catalogVersion = catalogVersion_;
+}
+
+void PlanCache::evictNoLock() {
+    while (slots.size() > capacity) {
+        slots.erase(lruKeys.back());
+        lruKeys.pop_back();
+        numEvictions++;
+    }
+}
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,202 @@
+#include "main/result_cache.h"
+
+#include <algorithm>
+
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/assert.h"
+#include "planner/operator/extend/base_logical_extend.h"
+#include "planner/operator/logical_plan.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace main {
+
+static void collectTables(const LogicalOperator& op, ResultCacheEntry& entry) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        for (auto tableID : op.constCast<LogicalScanNodeTable>().getTableIDs()) {
+            entry.tableIDs.insert(tableID);
+        }
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        for (auto relGroupEntry : op.constCast<BaseLogicalExtend>().getRel()->getEntries()) {
+            for (auto& info : relGroupEntry->constCast<RelGroupCatalogEntry>().getRelEntryInfos()) {
+                entry.tableIDs.insert(info.oid);
+            }
+        }
+    } break;
+    // These operators read tables through a projected graph or an index, which we do not
+    // resolve to individual tables.
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    case LogicalOperatorType::PATH_PROPERTY_PROBE:
+    case LogicalOperatorType::INDEX_LOOK_UP:
+    case LogicalOperatorType::TABLE_FUNCTION_CALL:
+    case LogicalOperatorType::EXTENSION:
+    case LogicalOperatorType::EXTENSION_CLAUSE: {
+        entry.readsAllTables = true;
+    } break;
+    default:
+        break;
+    }
+    for (auto& child : op.getChildren()) {
+        collectTables(*child, entry);
+    }
+}
+
+void ResultCacheEntry::collectTables(const LogicalPlan& plan) {
+    main::collectTables(*plan.getLastOperator(), *this);
+}
+
+uint64_t ResultCache::getGeneration() const {
+    std::unique_lock lck{mtx};
+    return generation;
+}
+
+std::shared_ptr<const ResultCacheEntry> ResultCache::lookup(const std::string& key,
+    uint64_t catalogVersion_) {
+    std::unique_lock lck{mtx};
+    validateCatalogVersionNoLock(catalogVersion_);
+    const auto it = slots.find(key);
+    if (it == slots.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    numHits++;
+    lruKeys.splice(lruKeys.begin(), lruKeys, it->second.lruPos);
+    return it->second.entry;
+}
+
+void ResultCache::insert(const std::string& key, uint64_t catalogVersion_, uint64_t generation_,
+    std::shared_ptr<const ResultCacheEntry> entry) {
+    std::unique_lock lck{mtx};
+    validateCatalogVersionNoLock(catalogVersion_);
+    if (capacity == 0 || entry->memoryUsage > capacity) {
+        return;
+    }
+    if (entry->readsAllTables) {
+        if (generation != generation_ || !numPendingInvalidations.empty()) {
+            return;
+        }
+    } else {
+        for (auto tableID : entry->tableIDs) {
+            if (numPendingInvalidations.contains(tableID) ||
+                (tableGenerations.contains(tableID) && tableGenerations.at(tableID) > generation_)) {
+                return;
+            }
+        }
+    }
+    eraseNoLock(key);
+    memoryUsage += entry->memoryUsage;
+    lruKeys.push_front(key);
+    slots.emplace(key, Slot{std::move(entry), lruKeys.begin()});
+    evictNoLock();
+}
+
+void ResultCache::startInvalidation(const table_id_set_t& tableIDs) {
+    if (tableIDs.empty()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    for (auto tableID : tableIDs) {
+        numPendingInvalidations[tableID]++;
+    }
+    invalidateNoLock(tableIDs);
+}
+
+void ResultCache::finishInvalidation(const table_id_set_t& tableIDs) {
+    if (tableIDs.empty()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    for (auto tableID : tableIDs) {
+        KU_ASSERT(numPendingInvalidations.contains(tableID));
+        if (--numPendingInvalidations.at(tableID) == 0) {
+            numPendingInvalidations.erase(tableID);
+        }
+    }
+    // Results computed from a snapshot taken while the commit was in progress may miss its changes.
+    invalidateNoLock(tableIDs);
+}
+
+void ResultCache::setCapacity(uint64_t newCapacity) {
+    std::unique_lock lck{mtx};
+    capacity = newCapacity;
+    evictNoLock();
+}
+
+void ResultCache::clear() {
+    std::unique_lock lck{mtx};
+    numInvalidations += slots.size();
+    slots.clear();
+    lruKeys.clear();
+    memoryUsage = 0;
+}
+
+ResultCacheStats ResultCache::getStats() const {
+    std::unique_lock lck{mtx};
+    ResultCacheStats stats;
+    stats.numEntries = slots.size();
+    stats.memoryUsage = memoryUsage;
+    stats.capacity = capacity;
+    stats.numHits = numHits;
+    stats.numMisses = numMisses;
+    stats.numEvictions = numEvictions;
+    stats.numInvalidations = numInvalidations;
+    return stats;
+}
+
+void ResultCache::validateCatalogVersionNoLock(uint64_t catalogVersion_) {
+    if (catalogVersion_ == catalogVersion) {
+        return;
+    }
+    numInvalidations += slots.size();
+    slots.clear();
+    lruKeys.clear();
+    memoryUsage = 0;
+    catalogVersion = catalogVersion_;
+}
+
+void ResultCache::invalidateNoLock(const table_id_set_t& tableIDs) {
+    generation++;
+    for (auto tableID : tableIDs) {
+        tableGenerations[tableID] = generation;
+    }
+    std::vector<std::string> keysToErase;
+    for (auto& [key, slot] : slots) {
+        const auto& entry = *slot.entry;
+        if (entry.readsAllTables || std::ranges::any_of(entry.tableIDs,
+                                        [&](auto tableID) { return tableIDs.contains(tableID); })) {
+            keysToErase.push_back(key);
+        }
+    }
+    for (auto& key : keysToErase) {
+        eraseNoLock(key);
+        numInvalidations++;
+    }
+}
+
+void ResultCache::eraseNoLock(const std::string& key) {
+    const auto it = slots.find(key);
+    if (it == slots.end()) {
+        return;
+    }
+    memoryUsage -= it->second.entry->memoryUsage;
+    lruKeys.erase(it->second.lruPos);
+    slots.erase(it);
+}
+
+void ResultCache::evictNoLock() {
+    while (!slots.empty() && (capacity == 0 || memoryUsage > capacity)) {
+        const auto key = lruKeys.back();
+        eraseNoLock(key);
+        numEvictions++;
+    }
+}
+
+} // namespace main
+} // namespace kuzu
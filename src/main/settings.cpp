@@ -3,7 +3,10 @@
 #include "common/exception/runtime.h"
 #include "common/task_system/progress_bar.h"
 #include "main/client_context.h"
+#include "main/database.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/result_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
@@ -68,6 +71,19 @@ common::Value SparseFrontierThresholdSetting::getSetting(const ClientContext* co
     return common::Value(context->getClientConfig()->sparseFrontierThreshold);
 }
 
+void WSPBucketWidthSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto bucketWidth = parameter.getValue<double>();
+    if (bucketWidth < 0) {
+        throw common::RuntimeException("WSP bucket width cannot be negative.");
+    }
+    context->getClientConfigUnsafe()->wspBucketWidth = bucketWidth;
+}
+
+common::Value WSPBucketWidthSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->wspBucketWidth);
+}
+
 void EnableSemiMaskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enableSemiMask = parameter.getValue<bool>();
@@ -223,5 +239,52 @@ common::Value SpillToDiskSetting::getSetting(const ClientContext* context) {
     return common::Value::createValue(context->getDBConfig()->enableSpillingToDisk);
 }
 
+void BackgroundCheckpointSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->backgroundCheckpoint = parameter.getValue<bool>();
+}
+
+common::Value BackgroundCheckpointSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getDBConfig()->backgroundCheckpoint);
+}
+
+void WALCompressionSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->enableWALCompression = parameter.getValue<bool>();
+}
+
+common::Value WALCompressionSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getDBConfig()->enableWALCompression);
+}
+
+void PlanCacheSizeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto planCacheSize = parameter.getValue<int64_t>();
+    if (planCacheSize < 0) {
+        throw common::RuntimeException("Plan cache size cannot be negative.");
+    }
+    context->getDBConfigUnsafe()->planCacheSize = planCacheSize;
+    context->getDatabase()->getPlanCache()->setCapacity(planCacheSize);
+}
+
+common::Value PlanCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(static_cast<int64_t>(context->getDBConfig()->planCacheSize));
+}
+
+void ResultCacheSizeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto resultCacheSize = parameter.getValue<int64_t>();
+    if (resultCacheSize < 0) {
+        throw common::RuntimeException("Result cache size cannot be negative.");
+    }
+    context->getDBConfigUnsafe()->resultCacheSize = resultCacheSize;
+    context->getDatabase()->getResultCache()->setCapacity(resultCacheSize);
+}
+
+common::Value ResultCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(static_cast<int64_t>(context->getDBConfig()->resultCacheSize));
+}
+
 } // namespace main
 } // namespace kuzu
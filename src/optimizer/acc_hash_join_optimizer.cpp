@@ -1,6 +1,7 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 
 #include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/constants.h"
 #include "optimizer/logical_operator_collector.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_accumulate.h"
@@ -8,6 +9,7 @@
 #include "planner/operator/logical_intersect.h"
 #include "planner/operator/logical_path_property_probe.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/sip/logical_bloom_filter.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 
 using namespace kuzu::common;
@@ -306,17 +308,116 @@ static bool tryBuildToProbeHJSIP(LogicalOperator* op) {
     return true;
 }
 
+// Operators that stream tuples through the probe pipeline of a hash join without depending on the
+// tuples they drop. Dropping a tuple below them has the same effect as dropping it at the join.
+static bool canPassBloomFilterThrough(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::BLOOM_FILTER_PROBE:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::SEMI_MASKER:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Bloom filters are applied directly on top of the node, rel or table function scan that produces
+// the probe key. The scan must be in the same pipeline as the hash join probe so that the build
+// side, and thus the bloom filter, is complete before the scan starts.
+static std::shared_ptr<LogicalOperator> tryApplyBloomFilterProbe(
+    const std::shared_ptr<Expression>& key, const std::shared_ptr<LogicalOperator>& root,
+    std::vector<LogicalOperator*>& targets) {
+    if (!root->getSchema()->isExpressionInScope(*key)) {
+        return nullptr;
+    }
+    if (root->getNumChildren() > 0 &&
+        root->getChild(0)->getSchema()->isExpressionInScope(*key)) {
+        if (!canPassBloomFilterThrough(*root)) {
+            return nullptr;
+        }
+        auto newChild = tryApplyBloomFilterProbe(key, root->getChild(0), targets);
+        if (newChild == nullptr) {
+            return nullptr;
+        }
+        root->setChild(0, std::move(newChild));
+        return root;
+    }
+    switch (root->getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::TABLE_FUNCTION_CALL:
+        break;
+    default:
+        return nullptr;
+    }
+    auto probe = std::make_shared<LogicalBloomFilterProbe>(key, root);
+    probe->computeFlatSchema();
+    targets.push_back(probe.get());
+    return probe;
+}
+
+// Semi masks only prune scans of node tables on node ID keys. Bloom filters are built from the
+// join keys on the build side, whatever their type, and prune the probe side scans producing them.
+static bool tryBuildToProbeBloomFilterSIP(LogicalOperator* op) {
+    auto& hashJoin = op->cast<LogicalHashJoin>();
+    if (hashJoin.getJoinType() != JoinType::INNER ||
+        hashJoin.getSIPInfo().dependency == SIPDependency::PROBE_DEPENDS_ON_BUILD) {
+        return false;
+    }
+    auto probeRoot = hashJoin.getChild(0);
+    auto buildRoot = hashJoin.getChild(1);
+    if (!isBuildSideQualified(buildRoot.get()) &&
+        static_cast<double>(buildRoot->getCardinality()) * PlannerKnobs::SIP_RATIO >=
+            static_cast<double>(probeRoot->getCardinality())) {
+        return false;
+    }
+    auto hasBloomFilterApplied = false;
+    for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+        std::vector<LogicalOperator*> targets;
+        auto newProbeRoot = tryApplyBloomFilterProbe(probeKey, probeRoot, targets);
+        if (newProbeRoot == nullptr) {
+            continue;
+        }
+        probeRoot = newProbeRoot;
+        auto builder = std::make_shared<LogicalBloomFilterBuilder>(buildKey, buildRoot);
+        for (auto target : targets) {
+            builder->addTarget(target);
+        }
+        builder->computeFlatSchema();
+        buildRoot = builder;
+        hasBloomFilterApplied = true;
+    }
+    if (!hasBloomFilterApplied) {
+        return false;
+    }
+    // Bloom filter probes need to be mapped before their builders.
+    hashJoin.getSIPInfoUnsafe().dependency = SIPDependency::BUILD_DEPENDS_ON_PROBE;
+    hashJoin.setChild(0, probeRoot);
+    hashJoin.setChild(1, buildRoot);
+    return true;
+}
+
 void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     auto& hashJoin = op->cast<LogicalHashJoin>();
     if (LogicalOperatorUtils::isAccHashJoin(hashJoin)) {
         return;
     }
     if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT) {
+        // Semi masks are prohibited for non-ID based joins. Bloom filters can still be applied.
+        tryBuildToProbeBloomFilterSIP(op);
         return;
     }
     if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
         return;
     }
+    if (tryBuildToProbeBloomFilterSIP(op)) {
+        return;
+    }
     if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD) {
         return;
     }
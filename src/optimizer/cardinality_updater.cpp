@@ -82,7 +82,8 @@ void CardinalityUpdater::visitExtend(planner::LogicalOperator* op) {
     KU_ASSERT(transaction);
     auto& extend = op->cast<planner::LogicalExtend&>();
     const auto extensionRate = cardinalityEstimator.getExtensionRate(*extend.getRel(),
-        *extend.getBoundNode(), transaction);
+        *extend.getBoundNode(), extend.getDirection(), op->getChild(0)->getCardinality(),
+        transaction);
     extend.setCardinality(
         cardinalityEstimator.multiply(extensionRate, op->getChild(0)->getCardinality()));
 }
@@ -106,8 +107,9 @@ void CardinalityUpdater::visitIntersect(planner::LogicalOperator* op) {
     for (uint32_t i = 1; i < intersect.getNumChildren(); ++i) {
         buildOps.push_back(intersect.getChild(i).get());
     }
-    intersect.setCardinality(cardinalityEstimator.estimateIntersect(intersect.getKeyNodeIDs(),
-        *intersect.getChild(0), buildOps));
+    intersect.setCardinality(cardinalityEstimator.estimateIntersect(
+        *intersect.getIntersectNodeID(), intersect.getKeyNodeIDs(), *intersect.getChild(0),
+        buildOps));
 }
 
 void CardinalityUpdater::visitFlatten(planner::LogicalOperator* op) {
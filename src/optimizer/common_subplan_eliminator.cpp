@@ -0,0 +1,341 @@
+#include "optimizer/common_subplan_eliminator.h"
+
+#include <cctype>
+
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/node_rel_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_common_subplan.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_flatten.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/sip/logical_bloom_filter.h"
+#include "planner/operator/sip/logical_semi_masker.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+// Serializes subplans such that identical subplans serialize to the same string. Unique names
+// generated by the binder have the form "_<id>_<name>". They are replaced by the order in which
+// their ids first appear, so the serialization does not depend on the ids or names of variables.
+class SubplanSerializer {
+public:
+    // Returns false if the subplan cannot be shared, e.g. it contains an operator or a function
+    // that is not whitelisted.
+    bool serialize(const LogicalOperator& op, std::string& result);
+    bool serialize(const Expression& expr, std::string& result);
+
+private:
+    bool serialize(const expression_vector& exprs, std::string& result);
+    static void serialize(const table_id_vector_t& tableIDs, std::string& result);
+    static void serialize(const std::vector<storage::ColumnPredicateSet>& predicates,
+        std::string& result);
+
+    std::string canonicalize(const std::string& name);
+
+private:
+    std::unordered_map<std::string, std::string> idMap;
+};
+
+bool SubplanSerializer::serialize(const LogicalOperator& op, std::string& result) {
+    result += LogicalOperatorUtils::logicalOperatorTypeToString(op.getOperatorType()) + "[";
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op.constCast<LogicalScanNodeTable>();
+        if (scan.getScanType() != LogicalScanNodeTableType::SCAN ||
+            !serialize(*scan.getNodeID(), result) || !serialize(scan.getProperties(), result)) {
+            return false;
+        }
+        serialize(scan.getTableIDs(), result);
+        serialize(scan.getPropertyPredicates(), result);
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        auto& extend = op.constCast<LogicalExtend>();
+        result += std::to_string(static_cast<uint8_t>(extend.getDirection()));
+        result += extend.extendFromSourceNode() ? "src" : "dst";
+        result += extend.shouldScanNbrID() ? "nbr" : "";
+        if (!serialize(*extend.getBoundNode(), result) ||
+            !serialize(*extend.getNbrNode(), result) || !serialize(*extend.getRel(), result) ||
+            !serialize(extend.getProperties(), result)) {
+            return false;
+        }
+        serialize(extend.getPropertyPredicates(), result);
+    } break;
+    case LogicalOperatorType::FILTER: {
+        if (!serialize(*op.constCast<LogicalFilter>().getPredicate(), result)) {
+            return false;
+        }
+    } break;
+    case LogicalOperatorType::FLATTEN: {
+        result += std::to_string(op.constCast<LogicalFlatten>().getGroupPos());
+    } break;
+    case LogicalOperatorType::PROJECTION: {
+        if (!serialize(op.constCast<LogicalProjection>().getExpressionsToProject(), result)) {
+            return false;
+        }
+    } break;
+    case LogicalOperatorType::HASH_JOIN: {
+        auto& hashJoin = op.constCast<LogicalHashJoin>();
+        if (hashJoin.getJoinType() != JoinType::INNER) {
+            return false;
+        }
+        for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+            if (!serialize(*probeKey, result) || !serialize(*buildKey, result)) {
+                return false;
+            }
+        }
+    } break;
+    default:
+        return false;
+    }
+    result += "](";
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (!serialize(*op.getChild(i), result)) {
+            return false;
+        }
+        result += ",";
+    }
+    result += ")";
+    return true;
+}
+
+bool SubplanSerializer::serialize(const Expression& expr, std::string& result) {
+    result += ExpressionTypeUtil::toString(expr.expressionType) + "<" +
+              expr.getDataType().toString() + ">";
+    switch (expr.expressionType) {
+    case ExpressionType::LITERAL: {
+        result += expr.constCast<LiteralExpression>().getValue().toString();
+        return true;
+    }
+    case ExpressionType::PROPERTY:
+    case ExpressionType::VARIABLE:
+    case ExpressionType::PARAMETER: {
+        result += canonicalize(expr.getUniqueName());
+        return true;
+    }
+    case ExpressionType::PATTERN: {
+        result += canonicalize(expr.getUniqueName());
+        serialize(expr.constCast<NodeOrRelExpression>().getTableIDs(), result);
+        return true;
+    }
+    case ExpressionType::FUNCTION: {
+        // Functions without arguments, e.g. rand(), and functions with side effects, e.g.
+        // nextval(), may return a different value for each evaluation.
+        auto& function = expr.constCast<ScalarFunctionExpression>().getFunction();
+        if (expr.getNumChildren() == 0 || !function.isReadOnly) {
+            return false;
+        }
+    } break;
+    default: {
+        if (!ExpressionTypeUtil::isBoolean(expr.expressionType) &&
+            !ExpressionTypeUtil::isComparison(expr.expressionType) &&
+            !ExpressionTypeUtil::isNullOperator(expr.expressionType)) {
+            return false;
+        }
+    }
+    }
+    result += canonicalize(expr.getUniqueName());
+    return serialize(expr.getChildren(), result);
+}
+
+bool SubplanSerializer::serialize(const expression_vector& exprs, std::string& result) {
+    result += "(";
+    for (auto& expr : exprs) {
+        if (!serialize(*expr, result)) {
+            return false;
+        }
+        result += ",";
+    }
+    result += ")";
+    return true;
+}
+
+void SubplanSerializer::serialize(const table_id_vector_t& tableIDs, std::string& result) {
+    result += "{";
+    for (auto tableID : tableIDs) {
+        result += std::to_string(tableID) + ",";
+    }
+    result += "}";
+}
+
+void SubplanSerializer::serialize(const std::vector<storage::ColumnPredicateSet>& predicates,
+    std::string& result) {
+    for (auto& predicateSet : predicates) {
+        result += "{" + predicateSet.toString() + "}";
+    }
+}
+
+std::string SubplanSerializer::canonicalize(const std::string& name) {
+    std::string result;
+    auto i = 0u;
+    while (i < name.size()) {
+        auto isTokenStart = i == 0 || !(std::isalnum(name[i - 1]) || name[i - 1] == '_');
+        if (isTokenStart && name[i] == '_') {
+            auto j = i + 1;
+            while (j < name.size() && std::isdigit(name[j])) {
+                j++;
+            }
+            if (j > i + 1 && j < name.size() && name[j] == '_') {
+                auto id = name.substr(i + 1, j - i - 1);
+                if (!idMap.contains(id)) {
+                    idMap.insert({id, std::to_string(idMap.size())});
+                }
+                result += "_" + idMap.at(id) + "_";
+                // Skip the variable name following the id, which may differ across occurrences.
+                i = j + 1;
+                while (i < name.size() && (std::isalnum(name[i]) || name[i] == '_')) {
+                    i++;
+                }
+                continue;
+            }
+        }
+        result += name[i++];
+    }
+    return result;
+}
+
+// Materializing a subplan is only cheaper than re-evaluating it if the subplan joins.
+static bool containsJoin(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::EXTEND ||
+        op.getOperatorType() == LogicalOperatorType::HASH_JOIN) {
+        return true;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (containsJoin(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommonSubplanEliminator::rewrite(const LogicalPlan* plan) {
+    auto root = plan->getLastOperator().get();
+    // Evaluating a subplan once before all of its occurrences is only equivalent to evaluating it
+    // at each occurrence if the query does not modify the database.
+    if (root->hasUpdateRecursive()) {
+        return;
+    }
+    collectSIPTargets(root);
+    collectFingerprints(root);
+    collectOccurrences(root);
+    for (auto& fingerprint : orderedFingerprints) {
+        tryShare(occurrences.at(fingerprint));
+    }
+}
+
+void CommonSubplanEliminator::collectSIPTargets(const LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SEMI_MASKER: {
+        for (auto target : op->constCast<LogicalSemiMasker>().getTargetOperators()) {
+            sipTargets.insert(target);
+        }
+    } break;
+    case LogicalOperatorType::BLOOM_FILTER_BUILDER: {
+        for (auto target : op->constCast<LogicalBloomFilterBuilder>().getTargetOperators()) {
+            sipTargets.insert(target);
+        }
+    } break;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectSIPTargets(op->getChild(i).get());
+    }
+}
+
+bool CommonSubplanEliminator::collectFingerprints(LogicalOperator* op) {
+    auto canShare = !sipTargets.contains(op);
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        canShare = collectFingerprints(op->getChild(i).get()) && canShare;
+    }
+    if (!canShare || !containsJoin(*op)) {
+        return canShare;
+    }
+    std::string fingerprint;
+    if (SubplanSerializer().serialize(*op, fingerprint)) {
+        fingerprints.insert({op, fingerprint});
+        numFingerprints[fingerprint]++;
+    }
+    return canShare;
+}
+
+void CommonSubplanEliminator::collectOccurrences(LogicalOperator* op) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        auto child = op->getChild(i).get();
+        if (fingerprints.contains(child) && numFingerprints.at(fingerprints.at(child)) > 1) {
+            auto& fingerprint = fingerprints.at(child);
+            if (!occurrences.contains(fingerprint)) {
+                orderedFingerprints.push_back(fingerprint);
+            }
+            auto& subplanOccurrences = occurrences[fingerprint];
+            auto occurrence = occurrence_t{op, i};
+            // The same operator may be reachable through multiple parents.
+            if (std::find(subplanOccurrences.begin(), subplanOccurrences.end(), occurrence) ==
+                subplanOccurrences.end()) {
+                subplanOccurrences.push_back(occurrence);
+            }
+            continue;
+        }
+        collectOccurrences(child);
+    }
+}
+
+bool CommonSubplanEliminator::tryShare(const std::vector<occurrence_t>& subplanOccurrences) {
+    // Occurrences nested in another shared subplan are not collected, so fewer than two occurrences
+    // may remain.
+    if (subplanOccurrences.size() < 2) {
+        return false;
+    }
+    // Align the payloads of each occurrence with the payloads of the first occurrence. Serializing
+    // the subplan first makes the serialization of expressions comparable across occurrences.
+    std::vector<std::string> keys;
+    std::vector<expression_vector> payloads;
+    for (auto& [parent, childIdx] : subplanOccurrences) {
+        auto child = parent->getChild(childIdx);
+        auto serializer = SubplanSerializer();
+        std::string fingerprint;
+        serializer.serialize(*child, fingerprint);
+        std::unordered_map<std::string, std::shared_ptr<Expression>> keyToExpr;
+        for (auto& expr : child->getSchema()->getExpressionsInScope()) {
+            std::string key;
+            if (!serializer.serialize(*expr, key) || keyToExpr.contains(key)) {
+                return false;
+            }
+            keyToExpr.insert({key, expr});
+            if (payloads.empty()) {
+                keys.push_back(key);
+            }
+        }
+        if (keyToExpr.size() != keys.size()) {
+            return false;
+        }
+        expression_vector alignedPayloads;
+        for (auto& key : keys) {
+            if (!keyToExpr.contains(key)) {
+                return false;
+            }
+            alignedPayloads.push_back(keyToExpr.at(key));
+        }
+        payloads.push_back(std::move(alignedPayloads));
+    }
+    if (keys.empty()) {
+        return false;
+    }
+    auto subplanID = nextSubplanID++;
+    for (auto i = 0u; i < subplanOccurrences.size(); ++i) {
+        auto [parent, childIdx] = subplanOccurrences[i];
+        parent->setChild(childIdx, std::make_shared<LogicalCommonSubplan>(subplanID,
+                                       std::move(payloads[i]), parent->getChild(childIdx)));
+    }
+    return true;
+}
+
+} // namespace optimizer
+} // namespace kuzu
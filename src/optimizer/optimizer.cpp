@@ -4,6 +4,7 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/cardinality_updater.h"
+#include "optimizer/common_subplan_eliminator.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
@@ -51,6 +52,12 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto topKOptimizer = TopKOptimizer();
         topKOptimizer.rewrite(plan);
 
+        // CommonSubplanEliminator should be applied after HashJoinSIPOptimizer so that operators
+        // referenced by semi masks are not shared. It changes factorization structure and thus
+        // needs to be put before FactorizationRewriter.
+        auto commonSubplanEliminator = CommonSubplanEliminator();
+        commonSubplanEliminator.rewrite(plan);
+
         auto factorizationRewriter = FactorizationRewriter();
         factorizationRewriter.rewrite(plan);
 
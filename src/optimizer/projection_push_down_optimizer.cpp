@@ -63,7 +63,9 @@ void ProjectionPushDownOptimizer::visitPathPropertyProbe(LogicalOperator* op) {
         extend->setFunction(SingleSPDestinationsFunction::getAlgorithm());
     } else if (functionName == AllSPPathsFunction::name) {
         extend->setFunction(AllSPDestinationsFunction::getAlgorithm());
-    } else if (functionName == WeightedSPPathsFunction::name) {
+    } else if (functionName == WeightedSPPathsFunction::name &&
+               !propertiesInUse.contains(extend->getBindData().lengthExpr)) {
+        // Weighted shortest path destinations do not track path lengths.
         extend->setFunction(WeightedSPDestinationsFunction::getAlgorithm());
     }
     extend->setResultColumns(extend->getFunction().getResultColumns(extend->getBindData()));
@@ -1,8 +1,13 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include <limits>
+
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "common/enums/extend_direction_util.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
+#include "planner/operator/extend/base_logical_extend.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -34,6 +39,12 @@ void CardinalityEstimator::init(const QueryGraph& queryGraph) {
     }
 }
 
+void CardinalityEstimator::cacheDegreeStats(const QueryGraph& queryGraph) const {
+    for (auto i = 0u; i < queryGraph.getNumQueryRels(); ++i) {
+        getDegreeStats(queryGraph.getQueryRel(i)->getInnerRelTableIDs(), ExtendDirection::BOTH);
+    }
+}
+
 void CardinalityEstimator::init(const NodeExpression& node) {
     auto key = node.getInternalID()->getUniqueName();
     cardinality_t numNodes = 0u;
@@ -97,10 +108,11 @@ uint64_t CardinalityEstimator::estimateHashJoin(
                           JoinOrderUtil::getJoinKeysFlatCardinality(joinKeys, buildOp) /
                           atLeastOne(denominator));
     } else {
-        // Naively estimate the cardinality if the join is non-ID based
+        // Estimate each condition from the histograms of both sides if they exist, and assume
+        // independence across conditions.
         cardinality_t estCardinality = probeOp.getCardinality() * buildOp.getCardinality();
-        for (size_t i = 0; i < joinConditions.size(); ++i) {
-            estCardinality *= PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+        for (auto& joinCondition : joinConditions) {
+            estCardinality *= estimateJoinConditionSelectivity(joinCondition);
         }
         return atLeastOne(estCardinality);
     }
@@ -111,23 +123,55 @@ uint64_t CardinalityEstimator::estimateCrossProduct(const LogicalOperator& probe
     return atLeastOne(probeOp.getCardinality() * buildOp.getCardinality());
 }
 
-uint64_t CardinalityEstimator::estimateIntersect(const expression_vector& joinNodeIDs,
-    const LogicalOperator& probeOp, const std::vector<LogicalOperator*>& buildOps) const {
-    // Formula 1: treat intersect as a Filter on probe side.
-    uint64_t estCardinality1 =
-        probeOp.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
-    // Formula 2: assume independence on join conditions.
-    cardinality_t denominator = 1u;
-    for (auto& joinNodeID : joinNodeIDs) {
-        denominator *= getNodeIDDom(joinNodeID->getUniqueName());
+uint64_t CardinalityEstimator::estimateIntersect(const Expression& intersectNodeID,
+    const expression_vector& boundNodeIDs, const LogicalOperator& probeOp,
+    const std::vector<LogicalOperator*>& buildOps) const {
+    KU_ASSERT(boundNodeIDs.size() == buildOps.size());
+    // Each probe tuple intersects one adjacency list per build side. Assuming the lists are
+    // independent samples of the intersect node domain, k lists of lengths l_1..l_k share
+    // l_1 * ... * l_k / dom^(k-1) values. The result can never exceed the shortest list.
+    auto dom = static_cast<double>(nodeIDName2dom.contains(intersectNodeID.getUniqueName()) ?
+                                       getNodeIDDom(intersectNodeID.getUniqueName()) :
+                                       1);
+    auto numMatchesPerTuple = 1.0;
+    auto minListLength = std::numeric_limits<double>::max();
+    for (auto i = 0u; i < buildOps.size(); ++i) {
+        auto listLength = getIntersectListLength(*boundNodeIDs[i], probeOp, *buildOps[i]);
+        numMatchesPerTuple *= listLength;
+        if (i > 0) {
+            numMatchesPerTuple /= dom;
+        }
+        minListLength = std::min(minListLength, listLength);
     }
-    auto numerator = probeOp.getCardinality();
-    for (auto& buildOp : buildOps) {
-        numerator *= buildOp->getCardinality();
+    numMatchesPerTuple = std::min(numMatchesPerTuple, minListLength);
+    return atLeastOne(probeOp.getCardinality() * numMatchesPerTuple);
+}
+
+double CardinalityEstimator::getIntersectListLength(const Expression& boundNodeID,
+    const LogicalOperator& probeOp, const LogicalOperator& buildOp) const {
+    auto buildCard = static_cast<double>(buildOp.getCardinality());
+    // Build sides are rel scans, optionally filtered, projected and flattened.
+    auto op = &buildOp;
+    while (op->getOperatorType() == LogicalOperatorType::FLATTEN ||
+           op->getOperatorType() == LogicalOperatorType::FILTER ||
+           op->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        op = op->getChild(0).get();
     }
-    auto estCardinality2 = numerator / atLeastOne(denominator);
-    // Pick minimum between the two formulas.
-    return atLeastOne(std::min<uint64_t>(estCardinality1, estCardinality2));
+    if (op->getOperatorType() == LogicalOperatorType::EXTEND) {
+        auto& extend = op->constCast<BaseLogicalExtend>();
+        if (extend.getBoundNode()->getInternalID()->getUniqueName() ==
+            boundNodeID.getUniqueName()) {
+            auto extensionRate = getExtensionRate(*extend.getRel(), *extend.getBoundNode(),
+                extend.getDirection(), probeOp.getCardinality(), Transaction::Get(*context));
+            // Predicates on the rel or the intersect node shrink every list proportionally.
+            auto selectivity = std::min(1.0, buildCard / atLeastOne(extend.getCardinality()));
+            return extensionRate * selectivity;
+        }
+    }
+    if (!nodeIDName2dom.contains(boundNodeID.getUniqueName())) {
+        return buildCard;
+    }
+    return buildCard / getNodeIDDom(boundNodeID.getUniqueName());
 }
 
 uint64_t CardinalityEstimator::estimateFlatten(const LogicalOperator& childOp,
@@ -150,47 +194,147 @@ static bool isSingleLabelledProperty(const Expression& expression) {
     return expression.constCast<PropertyExpression>().isSingleLabel();
 }
 
+static const storage::ColumnStats* getColumnStatsIfPossible(main::ClientContext* context,
+    const Expression& expression,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    if (!isSingleLabelledProperty(expression)) {
+        return nullptr;
+    }
+    auto& propertyExpr = expression.constCast<PropertyExpression>();
+    auto tableID = propertyExpr.getSingleTableID();
+    if (!nodeTableStats.contains(tableID) || !propertyExpr.hasProperty(tableID)) {
+        return nullptr;
+    }
+    auto transaction = Transaction::Get(*context);
+    auto entry = catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
+    auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+        return nullptr;
+    }
+    return &nodeTableStats.at(tableID).getColumnStats(columnID);
+}
+
 static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
     const Expression& predicate,
     const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
     KU_ASSERT(predicate.getNumChildren() >= 1);
-    if (isSingleLabelledProperty(*predicate.getChild(0))) {
-        auto& propertyExpr = predicate.getChild(0)->cast<PropertyExpression>();
-        auto tableID = propertyExpr.getSingleTableID();
-        if (nodeTableStats.contains(tableID) && propertyExpr.hasProperty(tableID)) {
-            auto transaction = Transaction::Get(*context);
-            auto entry =
-                catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
-            auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
-            if (columnID != INVALID_COLUMN_ID && columnID != ROW_IDX_COLUMN_ID) {
-                auto& stats = nodeTableStats.at(tableID);
-                return atLeastOne(stats.getNumDistinctValues(columnID));
-            }
-        }
+    auto columnStats = getColumnStatsIfPossible(context, *predicate.getChild(0), nodeTableStats);
+    if (columnStats == nullptr) {
+        return {};
+    }
+    return atLeastOne(columnStats->getNumDistinctValues());
+}
+
+static const storage::ColumnHistogram* getHistogram(const storage::ColumnStats* columnStats) {
+    if (columnStats == nullptr) {
+        return nullptr;
+    }
+    auto histogram = columnStats->getHistogram();
+    if (histogram == nullptr || histogram->getNumValues() == 0) {
+        return nullptr;
+    }
+    return histogram;
+}
+
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+// Estimates the selectivity of a comparison between a property and a literal from the histogram
+// of the property, if ANALYZE has built one.
+static std::optional<double> getHistogramSelectivityIfPossible(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    if (!ExpressionTypeUtil::isComparison(predicate.expressionType) ||
+        predicate.getNumChildren() != 2) {
+        return {};
+    }
+    auto comparisonType = predicate.expressionType;
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (property->expressionType == ExpressionType::LITERAL) {
+        std::swap(property, literal);
+        comparisonType = flipComparison(comparisonType);
+    }
+    if (literal->expressionType != ExpressionType::LITERAL) {
+        return {};
+    }
+    auto columnStats = getColumnStatsIfPossible(context, *property, nodeTableStats);
+    auto histogram = getHistogram(columnStats);
+    if (histogram == nullptr) {
+        return {};
+    }
+    auto value = storage::ColumnHistogram::toHistogramValue(
+        literal->constCast<LiteralExpression>().getValue());
+    if (!value.has_value()) {
+        return {};
+    }
+    switch (comparisonType) {
+    case ExpressionType::EQUALS:
+        return histogram->estimateEqualsFraction(*value, columnStats->getNumDistinctValues());
+    case ExpressionType::NOT_EQUALS:
+        return 1 - histogram->estimateEqualsFraction(*value, columnStats->getNumDistinctValues());
+    case ExpressionType::LESS_THAN:
+        return histogram->estimateLessThanFraction(*value, false /* inclusive */);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return histogram->estimateLessThanFraction(*value, true /* inclusive */);
+    case ExpressionType::GREATER_THAN:
+        return 1 - histogram->estimateLessThanFraction(*value, true /* inclusive */);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return 1 - histogram->estimateLessThanFraction(*value, false /* inclusive */);
+    default:
+        return {};
     }
-    return {};
 }
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    const auto selectivity = getHistogramSelectivityIfPossible(context, predicate, nodeTableStats);
+    if (selectivity.has_value()) {
+        return atLeastOne(childPlan.getCardinality() * selectivity.value());
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            const auto numDistinctValues =
-                getTableStatsIfPossible(context, predicate, nodeTableStats);
-            if (numDistinctValues.has_value()) {
-                return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
-            }
-            return atLeastOne(
-                childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+        const auto numDistinctValues = getTableStatsIfPossible(context, predicate, nodeTableStats);
+        if (numDistinctValues.has_value()) {
+            return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
         }
+        return atLeastOne(
+            childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
     } else {
         return atLeastOne(
             childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
     }
 }
 
+double CardinalityEstimator::estimateJoinConditionSelectivity(
+    const binder::expression_pair& joinCondition) const {
+    auto [left, right] = joinCondition;
+    auto leftStats = getColumnStatsIfPossible(context, *left, nodeTableStats);
+    auto rightStats = getColumnStatsIfPossible(context, *right, nodeTableStats);
+    auto leftHistogram = getHistogram(leftStats);
+    auto rightHistogram = getHistogram(rightStats);
+    if (leftHistogram == nullptr || rightHistogram == nullptr) {
+        return PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+    }
+    return leftHistogram->estimateJoinSelectivity(*rightHistogram,
+        leftStats->getNumDistinctValues(), rightStats->getNumDistinctValues());
+}
+
 uint64_t CardinalityEstimator::getNumNodes(const Transaction*,
     const std::vector<table_id_t>& tableIDs) const {
     cardinality_t numNodes = 0u;
@@ -211,12 +355,37 @@ uint64_t CardinalityEstimator::getNumRels(const Transaction* transaction,
     return atLeastOne(numRels);
 }
 
+storage::DegreeStats CardinalityEstimator::getDegreeStats(
+    const std::vector<table_id_t>& relTableIDs, ExtendDirection direction) const {
+    storage::DegreeStats result;
+    for (auto tableID : relTableIDs) {
+        auto& relTable =
+            storage::StorageManager::Get(*context)->getTable(tableID)->cast<storage::RelTable>();
+        for (auto dataDirection : relTable.getStorageDirections()) {
+            if (direction != ExtendDirection::BOTH &&
+                dataDirection != ExtendDirectionUtil::getRelDataDirection(direction)) {
+                continue;
+            }
+            const auto key = std::make_pair(tableID, dataDirection);
+            if (!relDegreeStats.contains(key)) {
+                relDegreeStats[key] =
+                    relTable.getDirectedTableData(dataDirection)->getDegreeStats();
+            }
+            result.merge(relDegreeStats.at(key));
+        }
+    }
+    return result;
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
-    const NodeExpression& boundNode, const Transaction* transaction) const {
-    auto numBoundNodes = static_cast<double>(getNumNodes(transaction, boundNode.getTableIDs()));
+    const NodeExpression& boundNode, ExtendDirection direction, cardinality_t boundNodeCard,
+    const Transaction* transaction) const {
+    auto numBoundNodes = getNumNodes(transaction, boundNode.getTableIDs());
     auto numRels = static_cast<double>(getNumRels(transaction, rel.getInnerRelTableIDs()));
     KU_ASSERT(numBoundNodes > 0);
-    auto oneHopExtensionRate = numRels / atLeastOne(numBoundNodes);
+    auto oneHopExtensionRate = numRels / static_cast<double>(atLeastOne(numBoundNodes));
+    oneHopExtensionRate *= getDegreeStats(rel.getInnerRelTableIDs(), direction)
+                               .getSkewDiscount(boundNodeCard, numBoundNodes);
     switch (rel.getRelType()) {
     case QueryRelType::NON_RECURSIVE: {
         return oneHopExtensionRate;
@@ -39,17 +39,28 @@ uint64_t CostModel::computeMarkJoinCost(const binder::expression_vector& joinNod
     return computeHashJoinCost(joinNodeIDs, probe, build);
 }
 
-uint64_t CostModel::computeIntersectCost(const LogicalPlan& probePlan,
-    const std::vector<LogicalPlan>& buildPlans) {
+uint64_t CostModel::computeIntersectCost(const binder::expression_vector& boundNodeIDs,
+    const LogicalPlan& probePlan, const std::vector<LogicalPlan>& buildPlans,
+    const std::vector<double>& listLengths) {
+    KU_ASSERT(boundNodeIDs.size() == buildPlans.size() && listLengths.size() == buildPlans.size());
     uint64_t cost = 0ul;
     cost += probePlan.getCost();
-    // TODO(Xiyang): think of how to calculate intersect cost such that it will be picked in worst
-    // case.
     cost += probePlan.getCardinality();
-    for (auto& buildPlan : buildPlans) {
-        KU_ASSERT(buildPlan.getCardinality() >= 1);
-        cost += buildPlan.getCost();
+    // Build sides are hashed on their bound node like a hash join build.
+    for (auto i = 0u; i < buildPlans.size(); ++i) {
+        KU_ASSERT(buildPlans[i].getCardinality() >= 1);
+        cost += buildPlans[i].getCost();
+        cost += PlannerKnobs::BUILD_PENALTY *
+                JoinOrderUtil::getJoinKeysFlatCardinality({boundNodeIDs[i]},
+                    buildPlans[i].getLastOperatorRef());
     }
+    // Intersecting sorted lists is a linear merge, so each probe tuple pays for the total length of
+    // its lists instead of the size of any intermediate result.
+    auto listLengthSum = 0.0;
+    for (auto listLength : listLengths) {
+        listLengthSum += listLength;
+    }
+    cost += static_cast<uint64_t>(probePlan.getCardinality() * listLengthSum);
     return cost;
 }
 
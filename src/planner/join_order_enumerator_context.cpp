@@ -16,6 +16,8 @@ void JoinOrderEnumeratorContext::init(const QueryGraph* queryGraph_,
     // Restart from level 1 for new query part so that we get hashJoin based plans
     // that uses subplans coming from previous query part.See example in planRelIndexJoin().
     currentLevel = 1;
+    plannedApproximately = false;
+    planningTimer.start();
 }
 
 SubqueryGraph JoinOrderEnumeratorContext::getFullyMatchedSubqueryGraph() const {
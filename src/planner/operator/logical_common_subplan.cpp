@@ -0,0 +1,29 @@
+#include "planner/operator/logical_common_subplan.h"
+
+#include "planner/operator/factorization/sink_util.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalCommonSubplan::computeFactorizedSchema() {
+    createEmptySchema();
+    auto childSchema = children[0]->getSchema();
+    SinkOperatorUtil::recomputeSchema(*childSchema, payloads, *schema);
+    // Keep payloads in the same order as in the child's scope since parents such as UNION match
+    // expressions by their position in scope.
+    std::vector<f_group_pos> payloadsGroupPos;
+    for (auto& payload : payloads) {
+        payloadsGroupPos.push_back(schema->getGroupPos(*payload));
+    }
+    schema->clearExpressionsInScope();
+    for (auto i = 0u; i < payloads.size(); ++i) {
+        schema->insertToScope(payloads[i], payloadsGroupPos[i]);
+    }
+}
+
+void LogicalCommonSubplan::computeFlatSchema() {
+    copyChildSchema(0);
+}
+
+} // namespace planner
+} // namespace kuzu
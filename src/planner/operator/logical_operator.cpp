@@ -18,6 +18,12 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "ALTER";
     case LogicalOperatorType::ATTACH_DATABASE:
         return "ATTACH_DATABASE";
+    case LogicalOperatorType::BLOOM_FILTER_BUILDER:
+        return "BLOOM_FILTER_BUILDER";
+    case LogicalOperatorType::BLOOM_FILTER_PROBE:
+        return "BLOOM_FILTER_PROBE";
+    case LogicalOperatorType::COMMON_SUBPLAN:
+        return "COMMON_SUBPLAN";
     case LogicalOperatorType::COPY_FROM:
         return "COPY_FROM";
     case LogicalOperatorType::COPY_TO:
@@ -110,12 +110,16 @@ void Planner::appendIntersect(const std::shared_ptr<Expression>& intersectNodeID
     intersect->computeFactorizedSchema();
     // update cost
     std::vector<LogicalOperator*> buildOps;
-    for (const auto& plan : buildPlans) {
-        buildOps.push_back(plan.getLastOperator().get());
+    std::vector<double> listLengths;
+    for (auto i = 0u; i < buildPlans.size(); ++i) {
+        buildOps.push_back(buildPlans[i].getLastOperator().get());
+        listLengths.push_back(cardinalityEstimator.getIntersectListLength(*boundNodeIDs[i],
+            probePlan.getLastOperatorRef(), buildPlans[i].getLastOperatorRef()));
     }
-    intersect->setCardinality(cardinalityEstimator.estimateIntersect(boundNodeIDs,
-        probePlan.getLastOperatorRef(), buildOps));
-    probePlan.setCost(CostModel::computeIntersectCost(probePlan, buildPlans));
+    intersect->setCardinality(cardinalityEstimator.estimateIntersect(*intersectNodeID,
+        boundNodeIDs, probePlan.getLastOperatorRef(), buildOps));
+    probePlan.setCost(
+        CostModel::computeIntersectCost(boundNodeIDs, probePlan, buildPlans, listLengths));
     probePlan.setLastOperator(std::move(intersect));
 }
 
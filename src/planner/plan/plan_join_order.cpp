@@ -1,14 +1,19 @@
+#include <atomic>
 #include <cmath>
+#include <functional>
 
 #include "binder/expression_visitor.h"
 #include "common/enums/join_type.h"
 #include "common/enums/rel_direction.h"
+#include "common/task_system/task_scheduler.h"
 #include "common/utils.h"
+#include "main/client_context.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
+#include "processor/execution_context.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -145,6 +150,14 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
         }
     }
     auto bestPlan = plans[bestIdx].copy();
+    // Approximate levels only extend plans by one variable at a time. Greedily merging components
+    // may find a cheaper bushy plan.
+    if (info.subqueryType == SubqueryPlanningType::NONE && context.plannedApproximately) {
+        auto greedyPlan = planJoinOrderGreedily();
+        if (!greedyPlan.isEmpty() && greedyPlan.getCost() < bestPlan.getCost()) {
+            bestPlan = std::move(greedyPlan);
+        }
+    }
     if (queryGraph.isEmpty()) {
         appendEmptyResult(bestPlan);
     }
@@ -153,7 +166,8 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
 
 void Planner::planLevel(uint32_t level) {
     KU_ASSERT(level > 1);
-    if (level > MAX_LEVEL_TO_PLAN_EXACTLY) {
+    if (level > MAX_LEVEL_TO_PLAN_EXACTLY || context.exceedsPlanningBudget()) {
+        context.plannedApproximately = true;
         planLevelApproximately(level);
     } else {
         planLevelExactly(level);
@@ -172,6 +186,11 @@ void Planner::planLevelExactly(uint32_t level) {
 }
 
 void Planner::planLevelApproximately(uint32_t level) {
+    // Still consider closing cycles with WCOJ so that cyclic patterns in large queries are not
+    // limited to binary joins.
+    for (auto leftLevel = 2u; leftLevel <= level / 2; ++leftLevel) {
+        planWCOJoin(leftLevel, level - leftLevel);
+    }
     planInnerJoin(1, level - 1);
 }
 
@@ -486,8 +505,67 @@ static bool needPruneImplicitJoins(const SubqueryGraph& leftSubgraph,
     return intersectionSize != numJoinNodes;
 }
 
+namespace {
+
+struct SubgraphPair {
+    SubqueryGraph subgraph;
+    SubqueryGraph otherSubgraph;
+    std::vector<std::shared_ptr<NodeExpression>> joinNodes;
+    // Whether the pair is joined with index nested loop joins, whose plans are never pruned.
+    bool plannedINLJoin = false;
+};
+
+// Plans each subgraph pair by exactly one of the threads working on the task.
+class SubgraphPairPlanningTask final : public Task {
+public:
+    SubgraphPairPlanningTask(uint64_t maxNumThreads, uint64_t numPairs,
+        std::function<void(idx_t)> planPair)
+        : Task{maxNumThreads}, numPairs{numPairs}, nextPairIdx{0}, planPair{std::move(planPair)} {}
+
+    void run() override {
+        for (auto i = nextPairIdx.fetch_add(1); i < numPairs; i = nextPairIdx.fetch_add(1)) {
+            planPair(i);
+        }
+    }
+
+private:
+    uint64_t numPairs;
+    std::atomic<uint64_t> nextPairIdx;
+    std::function<void(idx_t)> planPair;
+};
+
+} // namespace
+
+bool Planner::canPlanInnerJoinsInParallel(uint64_t numSubgraphPairs) const {
+    if (numSubgraphPairs < PlannerKnobs::MIN_NUM_SUBGRAPH_PAIRS_TO_PLAN_IN_PARALLEL ||
+        clientContext->getMaxNumThreadForExec() < 2) {
+        return false;
+    }
+    // The task scheduler checks the timeout of the active query while waiting for a task. Planning
+    // happens before the active query starts.
+    if (clientContext->hasTimeout()) {
+        return false;
+    }
+    // Planning recursive extends and subqueries modifies shared planner state.
+    auto queryGraph = context.queryGraph;
+    for (auto i = 0u; i < queryGraph->getNumQueryRels(); ++i) {
+        if (QueryRelTypeUtils::isRecursive(queryGraph->getQueryRel(i)->getRelType())) {
+            return false;
+        }
+    }
+    auto collector = SubqueryExprCollector();
+    for (auto& predicate : context.whereExpressionsSplitOnAND) {
+        collector.visit(predicate);
+    }
+    if (collector.hasSubquery()) {
+        return false;
+    }
+    return true;
+}
+
 void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
     KU_ASSERT(leftLevel <= rightLevel);
+    std::vector<SubgraphPair> subgraphPairs;
     for (auto& rightSubgraph : context.subPlansTable->getSubqueryGraphs(rightLevel)) {
         for (auto& nbrSubgraph : rightSubgraph.getNbrSubgraphs(leftLevel)) {
             // E.g. MATCH (a)->(b) MATCH (b)->(c)
@@ -502,17 +580,76 @@ void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
             if (needPruneImplicitJoins(nbrSubgraph, rightSubgraph, joinNodes.size())) {
                 continue;
             }
-            // If index nested loop (INL) join is possible, we prune hash join plans
-            if (tryPlanINLJoin(rightSubgraph, nbrSubgraph, joinNodes)) {
+            subgraphPairs.push_back({rightSubgraph, nbrSubgraph, std::move(joinNodes)});
+        }
+    }
+    auto flipPlan = leftLevel != rightLevel;
+    // Pairs only read plans of lower levels, so they can be planned independently. Hash join plans
+    // of a pair are pruned by the max cost of the plans added by previous pairs.
+    std::vector<subgraph_plan_vector_t> plansPerPair(subgraphPairs.size());
+    auto planPair = [&](idx_t pairIdx, uint64_t maxCost) {
+        auto& pair = subgraphPairs[pairIdx];
+        // If index nested loop (INL) join is possible, we prune hash join plans
+        if (tryPlanINLJoin(pair.subgraph, pair.otherSubgraph, pair.joinNodes,
+                plansPerPair[pairIdx])) {
+            pair.plannedINLJoin = true;
+            return;
+        }
+        planInnerHashJoin(pair.subgraph, pair.otherSubgraph, pair.joinNodes, flipPlan, maxCost,
+            plansPerPair[pairIdx]);
+    };
+    auto getMaxCost = [&](idx_t pairIdx) {
+        auto newSubgraph = subgraphPairs[pairIdx].subgraph;
+        newSubgraph.addSubqueryGraph(subgraphPairs[pairIdx].otherSubgraph);
+        return context.subPlansTable->getMaxCost(newSubgraph);
+    };
+    auto addPlans = [&](idx_t pairIdx, uint64_t maxCost) {
+        for (auto& subgraphPlan : plansPerPair[pairIdx]) {
+            if (!subgraphPairs[pairIdx].plannedINLJoin && subgraphPlan.joinCost >= maxCost) {
                 continue;
             }
-            planInnerHashJoin(rightSubgraph, nbrSubgraph, joinNodes, leftLevel != rightLevel);
+            context.addPlan(subgraphPlan.subgraph, std::move(subgraphPlan.plan));
         }
+    };
+    if (canPlanInnerJoinsInParallel(subgraphPairs.size())) {
+        cardinalityEstimator.cacheDegreeStats(*context.queryGraph);
+        // The max cost of a pair depends on the plans of previous pairs, so threads plan without
+        // pruning.
+        auto task = std::make_shared<SubgraphPairPlanningTask>(
+            clientContext->getMaxNumThreadForExec(), subgraphPairs.size(),
+            [&](idx_t pairIdx) { planPair(pairIdx, UINT64_MAX); });
+        auto executionContext =
+            processor::ExecutionContext(nullptr /* profiler */, clientContext, 0 /* queryID */);
+        // Planning may itself run on a worker thread, e.g. when a query is prepared by a table
+        // function. Launch a new worker thread so that the task always makes progress.
+        TaskScheduler::Get(*clientContext)
+            ->scheduleTaskAndWaitOrError(task, &executionContext,
+                true /* launchNewWorkerThread */);
+        // Prune while adding plans in the order of pairs, exactly as serial planning does, so the
+        // chosen plan does not depend on the number of threads.
+        for (auto i = 0u; i < subgraphPairs.size(); ++i) {
+            addPlans(i, getMaxCost(i));
+        }
+        return;
+    }
+    for (auto i = 0u; i < subgraphPairs.size(); ++i) {
+        auto maxCost = getMaxCost(i);
+        planPair(i, maxCost);
+        addPlans(i, maxCost);
     }
 }
 
 bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
+    subgraph_plan_vector_t result;
+    auto hasAppliedINLJoin = tryPlanINLJoin(subgraph, otherSubgraph, joinNodes, result);
+    context.addPlans(std::move(result));
+    return hasAppliedINLJoin;
+}
+
+bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
+    const std::vector<std::shared_ptr<NodeExpression>>& joinNodes,
+    subgraph_plan_vector_t& result) {
     if (joinNodes.size() > 1) {
         return false;
     }
@@ -520,7 +657,7 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
         return false;
     }
     if (subgraph.isSingleRel()) { // Always put single rel subgraph to right.
-        return tryPlanINLJoin(otherSubgraph, subgraph, joinNodes);
+        return tryPlanINLJoin(otherSubgraph, subgraph, joinNodes, result);
     }
     auto relPos = UINT32_MAX;
     for (auto i = 0u; i < context.queryGraph->getNumQueryRels(); ++i) {
@@ -547,7 +684,7 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
             auto plan = prevPlan.copy();
             appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), plan);
             appendFilters(predicates, plan);
-            context.addPlan(newSubgraph, std::move(plan));
+            result.emplace_back(newSubgraph, std::move(plan));
             hasAppliedINLJoin = true;
         }
     }
@@ -558,7 +695,17 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes, bool flipPlan) {
     auto newSubgraph = subgraph;
     newSubgraph.addSubqueryGraph(otherSubgraph);
-    auto maxCost = context.subPlansTable->getMaxCost(newSubgraph);
+    subgraph_plan_vector_t result;
+    planInnerHashJoin(subgraph, otherSubgraph, joinNodes, flipPlan,
+        context.subPlansTable->getMaxCost(newSubgraph), result);
+    context.addPlans(std::move(result));
+}
+
+void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
+    const std::vector<std::shared_ptr<NodeExpression>>& joinNodes, bool flipPlan,
+    uint64_t maxCost, subgraph_plan_vector_t& result) {
+    auto newSubgraph = subgraph;
+    newSubgraph.addSubqueryGraph(otherSubgraph);
     expression_vector joinNodeIDs;
     for (auto& joinNode : joinNodes) {
         joinNodeIDs.push_back(joinNode->getInternalID());
@@ -567,26 +714,235 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
         getNewlyMatchedExprs(subgraph, otherSubgraph, newSubgraph, context.getWhereExpressions());
     for (auto& leftPlan : context.getPlans(subgraph)) {
         for (auto& rightPlan : context.getPlans(otherSubgraph)) {
-            if (CostModel::computeHashJoinCost(joinNodeIDs, leftPlan, rightPlan) < maxCost) {
+            auto joinCost = CostModel::computeHashJoinCost(joinNodeIDs, leftPlan, rightPlan);
+            if (joinCost < maxCost) {
                 auto leftPlanProbeCopy = leftPlan.copy();
                 auto rightPlanBuildCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, leftPlanProbeCopy, rightPlanBuildCopy,
                     leftPlanProbeCopy);
                 appendFilters(predicates, leftPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
+                result.emplace_back(newSubgraph, std::move(leftPlanProbeCopy), joinCost);
             }
             // flip build and probe side to get another HashJoin plan
-            if (flipPlan &&
-                CostModel::computeHashJoinCost(joinNodeIDs, rightPlan, leftPlan) < maxCost) {
+            if (!flipPlan) {
+                continue;
+            }
+            auto flippedJoinCost = CostModel::computeHashJoinCost(joinNodeIDs, rightPlan, leftPlan);
+            if (flippedJoinCost < maxCost) {
                 auto leftPlanBuildCopy = leftPlan.copy();
                 auto rightPlanProbeCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, rightPlanProbeCopy, leftPlanBuildCopy,
                     rightPlanProbeCopy);
                 appendFilters(predicates, rightPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
+                result.emplace_back(newSubgraph, std::move(rightPlanProbeCopy), flippedJoinCost);
+            }
+        }
+    }
+}
+
+namespace {
+
+struct GreedyJoinComponent {
+    SubqueryGraph subgraph;
+    LogicalPlan plan;
+
+    GreedyJoinComponent(SubqueryGraph subgraph, LogicalPlan plan)
+        : subgraph{std::move(subgraph)}, plan{std::move(plan)} {}
+    GreedyJoinComponent(const GreedyJoinComponent& other)
+        : subgraph{other.subgraph}, plan{other.plan.copy()} {}
+};
+
+struct GreedyJoinCandidate {
+    // Indices of the merged components.
+    std::vector<idx_t> componentIndices;
+    SubqueryGraph subgraph;
+    LogicalPlan plan;
+};
+
+} // namespace
+
+static const LogicalPlan& getCheapestPlan(const std::vector<LogicalPlan>& plans) {
+    KU_ASSERT(!plans.empty());
+    auto bestIdx = 0u;
+    for (auto i = 1u; i < plans.size(); ++i) {
+        if (plans[i].getCost() < plans[bestIdx].getCost()) {
+            bestIdx = i;
+        }
+    }
+    return plans[bestIdx];
+}
+
+// GOO merges the components with the smallest intermediate result first. Cost breaks ties.
+static bool isBetterGreedyPlan(const LogicalPlan& plan, const LogicalPlan& other) {
+    if (plan.getCardinality() != other.getCardinality()) {
+        return plan.getCardinality() < other.getCardinality();
+    }
+    return plan.getCost() < other.getCost();
+}
+
+LogicalPlan Planner::planJoinOrderGreedily() {
+    const auto queryGraph = context.getQueryGraph();
+    auto subPlansTable = std::move(context.subPlansTable);
+    std::vector<GreedyJoinComponent> components;
+    for (auto nodePos = 0u; nodePos < queryGraph->getNumQueryNodes(); ++nodePos) {
+        auto subgraph = context.getEmptySubqueryGraph();
+        subgraph.addQueryNode(nodePos);
+        if (!subPlansTable->containSubgraphPlans(subgraph)) {
+            context.subPlansTable = std::move(subPlansTable);
+            return LogicalPlan();
+        }
+        auto& plan = getCheapestPlan(subPlansTable->getSubgraphPlans(subgraph));
+        components.emplace_back(subgraph, plan.copy());
+    }
+    auto getComponentIdx = [&](const std::string& nodeName) -> idx_t {
+        const auto nodePos = queryGraph->getQueryNodeIdx(nodeName);
+        for (auto i = 0u; i < components.size(); ++i) {
+            if (components[i].subgraph.queryNodesSelector[nodePos]) {
+                return i;
+            }
+        }
+        KU_UNREACHABLE;
+    };
+    // Candidate joins are planned in a scratch table that only holds the components to merge and
+    // the scans of the rels connecting them.
+    auto initScratchTable = [&](const std::vector<idx_t>& componentIndices,
+                                const std::vector<idx_t>& relPositions) {
+        context.subPlansTable = std::make_unique<SubPlansTable>();
+        context.subPlansTable->resize(context.maxLevel);
+        for (auto componentIdx : componentIndices) {
+            auto& component = components[componentIdx];
+            context.addPlan(component.subgraph, component.plan.copy());
+        }
+        for (auto relPos : relPositions) {
+            auto relSubgraph = context.getEmptySubqueryGraph();
+            relSubgraph.addQueryRel(relPos);
+            for (auto& plan : subPlansTable->getSubgraphPlans(relSubgraph)) {
+                context.addPlan(relSubgraph, plan.copy());
+            }
+        }
+    };
+    // SubqueryGraph is not assignable, so the best candidate is held by pointer.
+    std::unique_ptr<GreedyJoinCandidate> bestCandidate;
+    auto collectCandidate = [&](std::vector<idx_t> componentIndices,
+                                const SubqueryGraph& subgraph) {
+        if (!context.containPlans(subgraph)) {
+            return;
+        }
+        auto& plan = getCheapestPlan(context.getPlans(subgraph));
+        if (bestCandidate == nullptr || isBetterGreedyPlan(plan, bestCandidate->plan)) {
+            bestCandidate = std::make_unique<GreedyJoinCandidate>(
+                GreedyJoinCandidate{std::move(componentIndices), subgraph, plan.copy()});
+        }
+    };
+    auto plannedRels = context.getEmptySubqueryGraph();
+    while (components.size() > 1 ||
+           plannedRels.getNumQueryRels() < queryGraph->getNumQueryRels()) {
+        bestCandidate.reset();
+        for (auto relPos = 0u; relPos < queryGraph->getNumQueryRels(); ++relPos) {
+            if (plannedRels.queryRelsSelector[relPos]) {
+                continue;
+            }
+            auto rel = queryGraph->getQueryRel(relPos);
+            auto relSubgraph = context.getEmptySubqueryGraph();
+            relSubgraph.addQueryRel(relPos);
+            auto srcIdx = getComponentIdx(rel->getSrcNodeName());
+            auto dstIdx = getComponentIdx(rel->getDstNodeName());
+            auto& src = components[srcIdx];
+            auto& dst = components[dstIdx];
+            if (srcIdx == dstIdx) {
+                // Closing rel.
+                initScratchTable({srcIdx}, {relPos});
+                std::vector<std::shared_ptr<NodeExpression>> joinNodes{rel->getSrcNode()};
+                if (rel->getSrcNodeName() != rel->getDstNodeName()) {
+                    joinNodes.push_back(rel->getDstNode());
+                }
+                planInnerHashJoin(src.subgraph, relSubgraph, joinNodes, true /* flipPlan */);
+                auto newSubgraph = src.subgraph;
+                newSubgraph.addQueryRel(relPos);
+                collectCandidate({srcIdx}, newSubgraph);
+                continue;
+            }
+            initScratchTable({srcIdx, dstIdx}, {relPos});
+            auto newSubgraph = src.subgraph;
+            newSubgraph.addSubqueryGraph(dst.subgraph);
+            newSubgraph.addQueryRel(relPos);
+            // Extend either component over the rel and join the other one on the far end.
+            for (auto [from, to] : {std::make_pair(&src, &dst), std::make_pair(&dst, &src)}) {
+                auto fromNode = from == &src ? rel->getSrcNode() : rel->getDstNode();
+                auto toNode = from == &src ? rel->getDstNode() : rel->getSrcNode();
+                if (!tryPlanINLJoin(from->subgraph, relSubgraph, {fromNode})) {
+                    planInnerHashJoin(from->subgraph, relSubgraph, {fromNode}, true /* flipPlan */);
+                }
+                auto extendedSubgraph = from->subgraph;
+                extendedSubgraph.addQueryRel(relPos);
+                if (context.containPlans(extendedSubgraph)) {
+                    planInnerHashJoin(extendedSubgraph, to->subgraph, {toNode},
+                        true /* flipPlan */);
+                }
+            }
+            collectCandidate({srcIdx, dstIdx}, newSubgraph);
+        }
+        // Close cycles with an intersect on a node that at least two unplanned rels connect to the
+        // same component.
+        for (auto componentIdx = 0u; componentIdx < components.size(); ++componentIdx) {
+            auto& component = components[componentIdx];
+            for (auto nodePos = 0u; nodePos < queryGraph->getNumQueryNodes(); ++nodePos) {
+                if (component.subgraph.queryNodesSelector[nodePos]) {
+                    continue;
+                }
+                auto intersectNode = queryGraph->getQueryNode(nodePos);
+                std::vector<std::shared_ptr<RelExpression>> rels;
+                std::vector<idx_t> relPositions;
+                for (auto relPos = 0u; relPos < queryGraph->getNumQueryRels(); ++relPos) {
+                    if (plannedRels.queryRelsSelector[relPos]) {
+                        continue;
+                    }
+                    auto rel = queryGraph->getQueryRel(relPos);
+                    auto srcPos = queryGraph->getQueryNodeIdx(rel->getSrcNodeName());
+                    auto dstPos = queryGraph->getQueryNodeIdx(rel->getDstNodeName());
+                    auto otherPos = srcPos == nodePos ? dstPos : srcPos;
+                    if ((srcPos == nodePos) == (dstPos == nodePos) ||
+                        !component.subgraph.queryNodesSelector[otherPos]) {
+                        continue;
+                    }
+                    rels.push_back(rel);
+                    relPositions.push_back(relPos);
+                }
+                if (rels.size() < 2) {
+                    continue;
+                }
+                auto otherIdx = getComponentIdx(intersectNode->getUniqueName());
+                initScratchTable({componentIdx, otherIdx}, relPositions);
+                planWCOJoin(component.subgraph, rels, intersectNode);
+                auto intersectedSubgraph = component.subgraph;
+                for (auto relPos : relPositions) {
+                    intersectedSubgraph.addQueryRel(relPos);
+                }
+                if (context.containPlans(intersectedSubgraph)) {
+                    planInnerHashJoin(intersectedSubgraph, components[otherIdx].subgraph,
+                        {intersectNode}, true /* flipPlan */);
+                }
+                auto newSubgraph = intersectedSubgraph;
+                newSubgraph.addSubqueryGraph(components[otherIdx].subgraph);
+                collectCandidate({componentIdx, otherIdx}, newSubgraph);
+            }
+        }
+        if (bestCandidate == nullptr) {
+            context.subPlansTable = std::move(subPlansTable);
+            return LogicalPlan();
+        }
+        plannedRels.queryRelsSelector |= bestCandidate->subgraph.queryRelsSelector;
+        std::vector<GreedyJoinComponent> newComponents;
+        for (auto i = 0u; i < components.size(); ++i) {
+            if (!containsValue(bestCandidate->componentIndices, (idx_t)i)) {
+                newComponents.push_back(components[i]);
             }
         }
+        newComponents.emplace_back(bestCandidate->subgraph, std::move(bestCandidate->plan));
+        components = std::move(newComponents);
     }
+    context.subPlansTable = std::move(subPlansTable);
+    return std::move(components[0].plan);
 }
 
 static bool isExpressionNewlyMatched(const std::vector<SubqueryGraph>& prevs,
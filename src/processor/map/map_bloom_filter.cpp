@@ -0,0 +1,42 @@
+#include "planner/operator/sip/logical_bloom_filter.h"
+#include "processor/operator/bloom_filter.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapBloomFilterBuilder(
+    const LogicalOperator* logicalOperator) {
+    const auto& builder = logicalOperator->constCast<LogicalBloomFilterBuilder>();
+    const auto inSchema = builder.getChild(0)->getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto sharedState = std::make_shared<BloomFilterSharedState>();
+    std::vector<std::string> operatorNames;
+    // Target probes are mapped before the builder. See HashJoinSIPOptimizer.
+    for (auto& op : builder.getTargetOperators()) {
+        const auto physicalOp = logicalOpToPhysicalOpMap.at(op);
+        KU_ASSERT(physicalOp->getOperatorType() == PhysicalOperatorType::BLOOM_FILTER_PROBE);
+        physicalOp->ptrCast<BloomFilterProbe>()->addSharedState(sharedState);
+        operatorNames.push_back(PhysicalOperatorUtils::operatorToString(physicalOp));
+    }
+    auto keyPos = getDataPos(*builder.getKey(), *inSchema);
+    auto printInfo = std::make_unique<BloomFilterBuilderPrintInfo>(operatorNames);
+    return std::make_unique<BloomFilterBuilder>(keyPos, std::move(sharedState),
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapBloomFilterProbe(
+    const LogicalOperator* logicalOperator) {
+    const auto& probe = logicalOperator->constCast<LogicalBloomFilterProbe>();
+    const auto inSchema = probe.getChild(0)->getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto keyPos = getDataPos(*probe.getKey(), *inSchema);
+    auto printInfo = std::make_unique<BloomFilterProbePrintInfo>(probe.getKey());
+    return std::make_unique<BloomFilterProbe>(keyPos, std::move(prevOperator), getOperatorID(),
+        std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,80 @@
+#include "common/system_config.h"
+#include "planner/operator/logical_common_subplan.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::planner;
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapCommonSubplan(
+    const LogicalOperator* logicalOperator) {
+    const auto& subplan = logicalOperator->constCast<LogicalCommonSubplan>();
+    auto subplanID = subplan.getSubplanID();
+    if (!commonSubplans.contains(subplanID)) {
+        auto inSchema = subplan.getChild(0)->getSchema();
+        auto prevOperator = mapOperator(subplan.getChild(0).get());
+        auto state = CommonSubplanState();
+        state.resultCollector = createResultCollector(AccumulateType::REGULAR,
+            subplan.getPayloads(), inSchema, std::move(prevOperator));
+        state.table = state.resultCollector->getResultFTable();
+        commonSubplans.insert({subplanID, std::move(state)});
+    }
+    auto& state = commonSubplans.at(subplanID);
+    auto maxMorselSize = state.table->hasUnflatCol() ? 1 : DEFAULT_VECTOR_CAPACITY;
+    auto scan = createFTableScanAligned(subplan.getPayloads(), subplan.getSchema(), state.table,
+        maxMorselSize, physical_op_vector_t{});
+    state.scans.push_back(scan.get());
+    return scan;
+}
+
+// Pipelines are executed one at a time. A pipeline runs after its child pipelines, which run in the
+// order they are decomposed by QueryProcessor::decomposePlanIntoTask. Records the rank of each
+// pipeline in this execution order and the pipeline of each operator.
+static void collectPipelineRanks(PhysicalOperator* op, idx_t pipelineIdx,
+    std::vector<idx_t>& pipelineRanks, idx_t& numRankedPipelines,
+    std::unordered_map<const PhysicalOperator*, idx_t>& opToPipelineIdx) {
+    if (op->isSink()) {
+        pipelineIdx = pipelineRanks.size();
+        pipelineRanks.push_back(INVALID_IDX);
+    }
+    opToPipelineIdx.insert({op, pipelineIdx});
+    for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
+        collectPipelineRanks(op->getChild(i), pipelineIdx, pipelineRanks, numRankedPipelines,
+            opToPipelineIdx);
+    }
+    if (op->isSink()) {
+        pipelineRanks[pipelineIdx] = numRankedPipelines++;
+    }
+}
+
+void PlanMapper::attachCommonSubplans(PhysicalOperator* root) {
+    if (commonSubplans.empty()) {
+        return;
+    }
+    std::vector<idx_t> pipelineRanks;
+    idx_t numRankedPipelines = 0;
+    std::unordered_map<const PhysicalOperator*, idx_t> opToPipelineIdx;
+    collectPipelineRanks(root, INVALID_IDX, pipelineRanks, numRankedPipelines, opToPipelineIdx);
+    auto getRank = [&](const PhysicalOperator* op) {
+        KU_ASSERT(opToPipelineIdx.contains(op));
+        return pipelineRanks[opToPipelineIdx.at(op)];
+    };
+    for (auto& [_, state] : commonSubplans) {
+        // Attaching the result collector as a child of a scan schedules the materialization as a
+        // child pipeline of the scan's pipeline. Pick the scan whose pipeline runs first so that
+        // the table is complete before any scan reads it.
+        auto firstScan = state.scans[0];
+        for (auto scan : state.scans) {
+            if (getRank(scan) < getRank(firstScan)) {
+                firstScan = scan;
+            }
+        }
+        firstScan->addChild(std::move(state.resultCollector));
+    }
+    commonSubplans.clear();
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -30,6 +30,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapExplain(const LogicalOperator*
         profile->addChild(std::move(root));
         return profile;
     }
+    // The mapped plan is not part of the returned plan, so common subplans have to be attached to
+    // it here.
+    attachCommonSubplans(root.get());
     if (logicalExplain.getExplainType() == ExplainType::PHYSICAL_PLAN) {
         auto plan = std::make_unique<PhysicalPlan>(std::move(root));
         auto profiler = std::make_unique<Profiler>();
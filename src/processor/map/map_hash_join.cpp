@@ -92,6 +92,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
     auto hashJoinBuild = std::make_unique<HashJoinBuild>(PhysicalOperatorType::HASH_JOIN_BUILD,
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
         buildPrintInfo->copy());
+    hashJoinBuild->setEstimatedCardinality(hashJoin->getChild(1)->getCardinality());
     hashJoinBuild->setDescriptor(std::make_unique<ResultSetDescriptor>(buildSchema));
     // Create probe
     std::vector<DataPos> probeKeysDataPos;
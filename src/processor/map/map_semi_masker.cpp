@@ -86,7 +86,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapSemiMasker(
         }
     }
     auto keyPos = DataPos(inSchema->getExpressionPos(*semiMasker.getKey()));
-    auto sharedState = std::make_shared<SemiMaskerSharedState>(std::move(masksPerTable));
+    // Masks passed into node table scans only prune rows that the consuming join drops anyway, so
+    // they can be dropped at runtime. Masks of other targets may change query results.
+    auto canDisableDenseMasks = true;
+    for (auto& op : semiMasker.getTargetOperators()) {
+        if (logicalOpToPhysicalOpMap.at(op)->getOperatorType() !=
+            PhysicalOperatorType::SCAN_NODE_TABLE) {
+            canDisableDenseMasks = false;
+        }
+    }
+    auto sharedState =
+        std::make_shared<SemiMaskerSharedState>(std::move(masksPerTable), canDisableDenseMasks);
     auto printInfo = std::make_unique<SemiMaskerPrintInfo>(operatorNames);
     switch (semiMasker.getKeyType()) {
     case SemiMaskKeyType::NODE: {
@@ -34,6 +34,7 @@ std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* log
                 logicalPlan->getSchema(), std::move(root));
         }
     }
+    attachCommonSubplans(root.get());
     auto physicalPlan = std::make_unique<PhysicalPlan>(std::move(root));
     if (logicalPlan->isProfile()) {
         physicalPlan->lastOperator->ptrCast<Profile>()->setPhysicalPlan(physicalPlan.get());
@@ -56,6 +57,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     case LogicalOperatorType::ATTACH_DATABASE: {
         physicalOperator = mapAttachDatabase(logicalOperator);
     } break;
+    case LogicalOperatorType::BLOOM_FILTER_BUILDER: {
+        physicalOperator = mapBloomFilterBuilder(logicalOperator);
+    } break;
+    case LogicalOperatorType::BLOOM_FILTER_PROBE: {
+        physicalOperator = mapBloomFilterProbe(logicalOperator);
+    } break;
+    case LogicalOperatorType::COMMON_SUBPLAN: {
+        physicalOperator = mapCommonSubplan(logicalOperator);
+    } break;
     case LogicalOperatorType::COPY_FROM: {
         physicalOperator = mapCopyFrom(logicalOperator);
     } break;
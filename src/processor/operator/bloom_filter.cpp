@@ -0,0 +1,117 @@
+#include "processor/operator/bloom_filter.h"
+
+#include "binder/expression/expression.h" // IWYU pragma: keep
+#include "function/hash/vector_hash_functions.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace processor {
+
+bloom_filter_hashes_t* BloomFilterSharedState::appendLocalHashes(storage::MemoryManager* mm) {
+    std::unique_lock lock{mtx};
+    localHashes.push_back(
+        std::make_unique<bloom_filter_hashes_t>(storage::MmAllocator<hash_t>(mm)));
+    return localHashes.back().get();
+}
+
+void BloomFilterSharedState::mergeToGlobal() {
+    std::unique_lock lock{mtx};
+    uint64_t numKeys = 0;
+    for (auto& hashes : localHashes) {
+        numKeys += hashes->size();
+    }
+    bloomFilter = std::make_unique<BlockedBloomFilter>(numKeys);
+    for (auto& hashes : localHashes) {
+        for (auto hash : *hashes) {
+            bloomFilter->insert(hash);
+        }
+        hashes.reset();
+    }
+    localHashes.clear();
+}
+
+std::string BloomFilterBuilderPrintInfo::toString() const {
+    std::string result = "Operators: ";
+    for (const auto& op : operatorNames) {
+        result += op;
+        if (&op != &operatorNames.back()) {
+            result += ", ";
+        }
+    }
+    return result;
+}
+
+void BloomFilterBuilder::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    keyVector = resultSet->getValueVector(keyPos).get();
+    const auto mm = storage::MemoryManager::Get(*context->clientContext);
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
+    localHashes = sharedState->appendLocalHashes(mm);
+}
+
+bool BloomFilterBuilder::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    auto& selVector = keyVector->state->getSelVector();
+    VectorHashFunction::computeHash(*keyVector, selVector, *hashVector, selVector);
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        // Null keys never join.
+        if (!keyVector->isNull(pos)) {
+            localHashes->push_back(hashVector->getValue<hash_t>(pos));
+        }
+    }
+    metrics->numOutputTuple.increase(selVector.getSelSize());
+    return true;
+}
+
+void BloomFilterBuilder::finalizeInternal(ExecutionContext* /*context*/) {
+    sharedState->mergeToGlobal();
+}
+
+std::string BloomFilterProbePrintInfo::toString() const {
+    return "Key: " + key->toString();
+}
+
+void BloomFilterProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    keyVector = resultSet->getValueVector(keyPos).get();
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(),
+        storage::MemoryManager::Get(*context->clientContext));
+}
+
+bool BloomFilterProbe::getNextTuplesInternal(ExecutionContext* context) {
+    sel_t numSelectValue = 0;
+    do {
+        restoreSelVector(*keyVector->state);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(*keyVector->state);
+        auto& selVector = keyVector->state->getSelVectorUnsafe();
+        VectorHashFunction::computeHash(*keyVector, selVector, *hashVector, selVector);
+        numSelectValue = 0;
+        auto buffer = selVector.getMutableBuffer();
+        for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+            auto pos = selVector[i];
+            buffer[numSelectValue] = pos;
+            auto mayJoin = !keyVector->isNull(pos);
+            for (auto& sharedState : sharedStates) {
+                auto bloomFilter = sharedState->getBloomFilter();
+                KU_ASSERT(bloomFilter != nullptr);
+                mayJoin = mayJoin && bloomFilter->mayContain(hashVector->getValue<hash_t>(pos));
+            }
+            numSelectValue += mayJoin;
+        }
+        selVector.setToFiltered();
+    } while (numSelectValue == 0);
+    keyVector->state->getSelVectorUnsafe().setSelSize(numSelectValue);
+    metrics->numOutputTuple.increase(numSelectValue);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
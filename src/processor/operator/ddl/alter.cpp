@@ -6,6 +6,7 @@
 #include "common/enums/alter_type.h"
 #include "common/exception/binder.h"
 #include "common/exception/runtime.h"
+#include "main/materialized_view.h"
 #include "processor/execution_context.h"
 #include "storage/storage_manager.h"
 #include "storage/table/table.h"
@@ -211,12 +212,45 @@ static bool checkDropFromToConflicts(const TableCatalogEntry& tableEntry,
     });
 }
 
+// A materialized view refers to its base tables and their properties by name, and the columns of
+// its view table must match its query.
+static void validateMaterializedViews(const TableCatalogEntry& entry, AlterType alterType,
+    main::ClientContext& context) {
+    if (alterType == AlterType::COMMENT) {
+        return;
+    }
+    auto catalog = Catalog::Get(context);
+    auto transaction = Transaction::Get(context);
+    if (main::MaterializedViewCatalogEntry::getViewOfTable(*catalog, transaction,
+            entry.getTableID()) != nullptr) {
+        throw BinderException(stringFormat(
+            "Cannot alter table {} because it stores a materialized view.", entry.getName()));
+    }
+    switch (alterType) {
+    case AlterType::RENAME:
+    case AlterType::DROP_PROPERTY:
+    case AlterType::RENAME_PROPERTY:
+    case AlterType::DROP_FROM_TO_CONNECTION:
+        break;
+    default:
+        return;
+    }
+    if (auto viewEntry = main::MaterializedViewCatalogEntry::getViewReferencing(*catalog,
+            transaction, entry.getTableID())) {
+        auto viewTableEntry = catalog->getTableCatalogEntry(transaction, viewEntry->getTableID());
+        throw BinderException(
+            stringFormat("Cannot alter table {} because it is referenced by materialized view {}.",
+                entry.getName(), viewTableEntry->getName()));
+    }
+}
+
 void Alter::alterTable(main::ClientContext* clientContext, const TableCatalogEntry& entry,
     const BoundAlterInfo& alterInfo) {
     auto catalog = Catalog::Get(*clientContext);
     auto transaction = Transaction::Get(*clientContext);
     auto memoryManager = storage::MemoryManager::Get(*clientContext);
     auto tableName = entry.getName();
+    validateMaterializedViews(entry, info.alterType, *clientContext);
     switch (info.alterType) {
     case AlterType::ADD_PROPERTY: {
         auto& extraInfo = info.extraInfo->constCast<BoundExtraAddPropertyInfo>();
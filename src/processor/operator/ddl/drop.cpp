@@ -6,6 +6,7 @@
 #include "common/exception/binder.h"
 #include "common/string_format.h"
 #include "main/client_context.h"
+#include "main/materialized_view.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "transaction/transaction.h"
@@ -74,6 +75,13 @@ void Drop::dropTable(const main::ClientContext* context) {
         }
     }
     auto entry = catalog->getTableCatalogEntry(transaction, dropInfo.name);
+    if (auto viewEntry = main::MaterializedViewCatalogEntry::getViewReferencing(*catalog,
+            transaction, entry->getTableID())) {
+        auto viewTableEntry = catalog->getTableCatalogEntry(transaction, viewEntry->getTableID());
+        throw BinderException(
+            stringFormat("Cannot delete table {} because it is referenced by materialized view {}.",
+                entry->getName(), viewTableEntry->getName()));
+    }
     switch (entry->getType()) {
     case CatalogEntryType::NODE_TABLE_ENTRY: {
         for (auto& indexEntry : catalog->getIndexEntries(transaction)) {
@@ -59,6 +59,15 @@ void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
     sharedState->getHashTable()->buildHashSlots();
 }
 
+std::unordered_map<std::string, std::string> HashJoinBuild::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    if (estimatedCardinality.has_value()) {
+        result.insert({"EstimatedCardinality", std::to_string(*estimatedCardinality)});
+    }
+    return result;
+}
+
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
     // Append thread-local tuples
     while (children[0]->getNextTuple(context)) {
@@ -196,6 +196,9 @@ uint64_t HashJoinProbe::getJoinResult() {
 // (all flat data chunks from the build side are merged into one) and buildSideVectorPtrs (each
 // VectorPtr corresponds to one unFlat build side data chunk that is appended to the resultSet).
 bool HashJoinProbe::getNextTuplesInternal(ExecutionContext* context) {
+    if (canSkipProbeSide()) {
+        return false;
+    }
     uint64_t numPopulatedTuples = 0;
     do {
         if (!getMatchedTuples(context)) {
@@ -207,5 +210,14 @@ bool HashJoinProbe::getNextTuplesInternal(ExecutionContext* context) {
     return true;
 }
 
+std::unordered_map<std::string, std::string> HashJoinProbe::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    if (canSkipProbeSide()) {
+        result.insert({"AdaptiveDecision", "Skipped probe side (empty build side)"});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
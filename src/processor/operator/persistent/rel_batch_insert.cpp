@@ -87,6 +87,8 @@ void RelBatchInsert::initGlobalStateInternal(ExecutionContext* context) {
         relBatchInsertInfo->direction == RelDataDirection::FWD ? 0 : 1;
     // Init shared state
     sharedState->table = partitionerSharedState->relTable;
+    // COPY appends to committed node groups directly.
+    transaction->getLocalStorage()->markCommittedRowsChanged(sharedState->table->getTableID());
     progressSharedState = std::make_shared<RelBatchInsertProgressSharedState>();
     progressSharedState->partitionsDone = 0;
     progressSharedState->partitionsTotal =
@@ -135,6 +137,11 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
     // in the node group)
     relTable.pushInsertInfo(transaction, direction, nodeGroup, chunkedGroup.getNumRows(), source);
     if (isNewNodeGroup) {
+        const auto& csrHeader = chunkedGroup.getCSRHeader();
+        DegreeStats degreeStats;
+        for (auto i = 0u; i < csrHeader.length->getNumValues(); i++) {
+            degreeStats.add(csrHeader.getCSRLength(i));
+        }
         auto flushedChunkedGroup = chunkedGroup.flush(transaction, pageAllocator);
 
         // If there are deleted columns that haven't been vacuumed yet
@@ -143,7 +150,7 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
         auto persistentChunkedGroup = std::make_unique<ChunkedCSRNodeGroup>(mm,
             flushedChunkedGroup->cast<ChunkedCSRNodeGroup>(), nodeGroup.getDataTypes(), columnIDs);
 
-        nodeGroup.setPersistentChunkedGroup(std::move(persistentChunkedGroup));
+        nodeGroup.setPersistentChunkedGroup(std::move(persistentChunkedGroup), degreeStats);
     } else {
         nodeGroup.appendChunkedCSRGroup(transaction, columnIDs, chunkedGroup);
     }
@@ -25,6 +25,10 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "ATTACH_DATABASE";
     case PhysicalOperatorType::BATCH_INSERT:
         return "BATCH_INSERT";
+    case PhysicalOperatorType::BLOOM_FILTER_BUILDER:
+        return "BLOOM_FILTER_BUILDER";
+    case PhysicalOperatorType::BLOOM_FILTER_PROBE:
+        return "BLOOM_FILTER_PROBE";
     case PhysicalOperatorType::COPY_TO:
         return "COPY_TO";
     case PhysicalOperatorType::CREATE_MACRO:
@@ -6,6 +6,7 @@
 #include "function/gds/compute.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/gds_utils.h"
+#include "function/gds/ms_bfs.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -83,6 +84,40 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+// Returns the destination node if the recursive join can search from both ends, i.e. the output
+// node mask lets through a single node and no node predicate applies to the nodes on the path.
+static std::optional<nodeID_t> getBidirectionalDstNode(const RJAlgorithm& function,
+    const RecursiveExtendSharedState& sharedState) {
+    auto outputNodeMask = sharedState.getOutputNodeMaskMap();
+    if (!function.supportsBidirectionalSearch() || outputNodeMask == nullptr ||
+        sharedState.getPathNodeMaskMap() != nullptr || outputNodeMask->getNumMaskedNode() != 1) {
+        return std::nullopt;
+    }
+    std::optional<nodeID_t> result;
+    for (auto& [tableID, mask] : outputNodeMask->getMasks()) {
+        if (!mask->isEnabled()) {
+            return std::nullopt;
+        }
+        for (auto offset : mask->range(0, mask->getMaxOffset())) {
+            result = nodeID_t{offset, tableID};
+        }
+    }
+    // The output node may be in a node table that the recursive join does not traverse.
+    auto graphTableIDs = sharedState.graph->getNodeTableIDs();
+    if (!result.has_value() ||
+        std::ranges::find(graphTableIDs, result->tableID) == graphTableIDs.end()) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Shortest path destinations from many sources are computed in batches by a multi-source BFS.
+// Paths and walks are tracked per source and cannot share visited sets.
+static bool useMultiSourceBFS(const RJAlgorithm& function, offset_t numSources) {
+    return function.getFunctionName() == SingleSPDestinationsFunction::name &&
+           numSources >= MultiSourceBFS::MIN_NUM_SOURCES;
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
@@ -105,6 +140,12 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         propertyNames.push_back(
             bindData.weightPropertyExpr->ptrCast<PropertyExpression>()->getPropertyName());
     }
+    auto bidirectionalDstNodeID = getBidirectionalDstNode(*function, *sharedState);
+    std::unique_ptr<MultiSourceBFS> multiSourceBFS;
+    std::vector<nodeID_t> batchSourceNodeIDs;
+    if (useMultiSourceBFS(*function, totalNumNodes)) {
+        multiSourceBFS = std::make_unique<MultiSourceBFS>(context, bindData, sharedState.get());
+    }
     offset_t completedNumNodes = 0;
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
     for (auto& tableID : graph->getNodeTableIDs()) {
@@ -115,14 +156,37 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         if (!inputNodeTableIDSet.contains(tableID)) {
             continue;
         }
-        auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
+        auto calcFunc = [tableID, propertyNames, graph, context, bidirectionalDstNodeID,
+                            &multiSourceBFS, &batchSourceNodeIDs, this](offset_t offset) {
             auto clientContext = context->clientContext;
-            auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
+            if (multiSourceBFS != nullptr) {
+                batchSourceNodeIDs.push_back(sourceNodeID);
+                if (batchSourceNodeIDs.size() == MultiSourceBFS::MAX_NUM_SOURCES) {
+                    multiSourceBFS->run(batchSourceNodeIDs);
+                    batchSourceNodeIDs.clear();
+                }
+                return;
+            }
+            auto computeState = function->getComputeState(context, bindData, sharedState.get());
             computeState->initSource(sourceNodeID);
-            GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
-                bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
-                propertyNames);
+            if (bidirectionalDstNodeID.has_value() && *bidirectionalDstNodeID != sourceNodeID) {
+                auto dstNodeID = *bidirectionalDstNodeID;
+                auto dstComputeState =
+                    function->getComputeState(context, bindData, sharedState.get());
+                dstComputeState->initSource(dstNodeID);
+                auto meetNodeID = GDSUtils::runBidirectionalRecursiveJoinEdgeCompute(context,
+                    *computeState, *dstComputeState, graph, bindData.extendDirection,
+                    bindData.upperBound, propertyNames);
+                if (meetNodeID.has_value()) {
+                    function->mergeBidirectionalSearch(*computeState, *dstComputeState,
+                        *meetNodeID, dstNodeID);
+                }
+            } else {
+                GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
+                    bindData.extendDirection, bindData.upperBound,
+                    sharedState->getOutputNodeMaskMap(), propertyNames);
+            }
             auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
                 sharedState.get());
             auto vertexCompute = std::make_unique<RJVertexCompute>(
@@ -153,6 +217,9 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
             }
         }
     }
+    if (!batchSourceNodeIDs.empty() && !sharedState->exceedLimit()) {
+        multiSourceBFS->run(batchSourceNodeIDs);
+    }
     sharedState->factorizedTablePool.mergeLocalTables();
 }
 
@@ -61,6 +61,21 @@ void SemiMaskerSharedState::mergeToGlobal() {
             }
         }
     }
+    if (!canDisableDenseMasks) {
+        return;
+    }
+    for (const auto& [tableID, globalVector] : masksPerTable) {
+        // All global masks of a table share the merged bitmap.
+        const auto mask = globalVector.front();
+        if (static_cast<double>(mask->getNumMaskedNodes()) <=
+            static_cast<double>(mask->getMaxOffset()) * DENSE_MASK_FRACTION) {
+            continue;
+        }
+        for (const auto& item : globalVector) {
+            item->disable();
+        }
+        tablesWithDisabledMasks.push_back(tableID);
+    }
 }
 
 std::string SemiMaskerPrintInfo::toString() const {
@@ -83,6 +98,17 @@ void BaseSemiMasker::finalizeInternal(ExecutionContext* /*context*/) {
     sharedState->mergeToGlobal();
 }
 
+std::unordered_map<std::string, std::string> BaseSemiMasker::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    const auto tableIDs = sharedState->getTablesWithDisabledMasks();
+    if (!tableIDs.empty()) {
+        result.insert({"AdaptiveDecision",
+            "Disabled dense semi mask on " + std::to_string(tableIDs.size()) + " table(s)"});
+    }
+    return result;
+}
+
 bool SingleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
         return false;
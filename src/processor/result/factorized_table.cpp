@@ -265,6 +265,14 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     return totalNumFlatTuples;
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    if (tableSchema.isEmpty()) {
+        return 0;
+    }
+    return flatTupleBlockCollection->getMemoryUsage() +
+           unFlatTupleBlockCollection->getMemoryUsage() + inMemOverflowBuffer->getMemoryUsage();
+}
+
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     std::unordered_map<uint32_t, bool> calculatedGroups;
     uint64_t numFlatTuples = 1;
@@ -8,7 +8,10 @@
 #include "common/serializer/in_mem_file_writer.h"
 #include "extension/extension_manager.h"
 #include "main/client_context.h"
+#include "main/database.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/result_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/database_header.h"
 #include "storage/shadow_utils.h"
@@ -89,6 +92,11 @@ void Checkpointer::writeCheckpoint() {
     bufferManager->removeEvictedCandidates();
 
     catalog::Catalog::Get(clientContext)->resetVersion();
+    // Cached plans are validated against the catalog version, which restarts from zero here. Drop
+    // them so that a plan cached under an earlier version can never be mistaken as current. This
+    // also lets plans pick up the statistics persisted by this checkpoint.
+    clientContext.getDatabase()->getPlanCache()->clear();
+    clientContext.getDatabase()->getResultCache()->clear();
     auto* dataFH = storageManager->getDataFH();
     dataFH->getPageManager()->resetVersion();
     storageManager->getWAL().reset();
@@ -190,6 +198,12 @@ bool Checkpointer::canAutoCheckpoint(const main::ClientContext& clientContext,
     return expectedSize > clientContext.getDBConfig()->checkpointThreshold;
 }
 
+bool Checkpointer::exceedsWALHardLimit(const main::ClientContext& clientContext) {
+    auto wal = WAL::Get(clientContext);
+    return wal->getFileSize() / common::WAL_SIZE_HARD_LIMIT_FACTOR >
+           clientContext.getDBConfig()->checkpointThreshold;
+}
+
 void Checkpointer::readCheckpoint() {
     auto storageManager = StorageManager::Get(clientContext);
     storageManager->initDataFileHandle(common::VirtualFileSystem::GetUnsafe(clientContext),
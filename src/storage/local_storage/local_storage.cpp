@@ -55,6 +55,14 @@ PageAllocator* LocalStorage::addOptimisticAllocator() {
     return optimisticAllocators.back().get();
 }
 
+table_id_set_t LocalStorage::getChangedTableIDs() const {
+    auto tableIDs = tablesWithCommittedRowChanges;
+    for (auto& [tableID, _] : tables) {
+        tableIDs.insert(tableID);
+    }
+    return tableIDs;
+}
+
 void LocalStorage::commit() {
     auto catalog = catalog::Catalog::Get(clientContext);
     auto transaction = transaction::Transaction::Get(clientContext);
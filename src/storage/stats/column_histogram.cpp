@@ -0,0 +1,451 @@
+#include "storage/stats/column_histogram.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/constants.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void StridedSample::append(double value) {
+    if (numValues++ % stride != 0) {
+        return;
+    }
+    values.push_back(value);
+    if (values.size() >= HistogramConstants::INSERT_SAMPLE_CAPACITY) {
+        for (auto i = 0u; i < values.size() / 2; i++) {
+            values[i] = values[i * 2];
+        }
+        values.resize(values.size() / 2);
+        stride *= 2;
+    }
+}
+
+void ColumnHistogram::MostCommonValue::serialize(Serializer& serializer) const {
+    serializer.serializeValue(value);
+    serializer.serializeValue(count);
+}
+
+ColumnHistogram::MostCommonValue ColumnHistogram::MostCommonValue::deserialize(
+    Deserializer& deserializer) {
+    MostCommonValue mostCommonValue;
+    deserializer.deserializeValue(mostCommonValue.value);
+    deserializer.deserializeValue(mostCommonValue.count);
+    return mostCommonValue;
+}
+
+ColumnHistogram ColumnHistogram::build(std::vector<double> sample, double numValues,
+    uint64_t numBuckets, uint64_t maxNumMostCommonValues) {
+    ColumnHistogram histogram;
+    if (sample.empty() || numBuckets == 0) {
+        return histogram;
+    }
+    std::sort(sample.begin(), sample.end());
+    const auto scale = numValues / sample.size();
+    std::vector<std::pair<double, uint64_t>> runs;
+    for (auto value : sample) {
+        if (!runs.empty() && runs.back().first == value) {
+            runs.back().second++;
+        } else {
+            runs.emplace_back(value, 1);
+        }
+    }
+    // A value is tracked as most common if it repeats noticeably more often than the average
+    // value. If there are few distinct values, all of them are tracked and no buckets are needed.
+    std::vector<std::pair<double, uint64_t>> candidates;
+    for (auto& run : runs) {
+        if (runs.size() <= maxNumMostCommonValues ||
+            (run.second > 1 && run.second * runs.size() * 4 > sample.size() * 5)) {
+            candidates.push_back(run);
+        }
+    }
+    if (candidates.size() > maxNumMostCommonValues) {
+        std::partial_sort(candidates.begin(), candidates.begin() + maxNumMostCommonValues,
+            candidates.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+        candidates.resize(maxNumMostCommonValues);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<double> mostCommonValueSet;
+    for (auto& [value, count] : candidates) {
+        histogram.mostCommonValues.push_back({value, count * scale});
+        mostCommonValueSet.push_back(value);
+    }
+    // Remaining values are distributed over buckets holding (roughly) the same number of values.
+    std::vector<double> remaining;
+    remaining.reserve(sample.size());
+    for (auto value : sample) {
+        if (!std::binary_search(mostCommonValueSet.begin(), mostCommonValueSet.end(), value)) {
+            remaining.push_back(value);
+        }
+    }
+    if (remaining.empty()) {
+        return histogram;
+    }
+    numBuckets = std::min<uint64_t>(numBuckets, remaining.size());
+    for (auto i = 0u; i < numBuckets; i++) {
+        const auto start = i * remaining.size() / numBuckets;
+        const auto end = (i + 1) * remaining.size() / numBuckets;
+        histogram.bounds.push_back(remaining[start]);
+        histogram.bucketCounts.push_back((end - start) * scale);
+    }
+    histogram.bounds.push_back(remaining.back());
+    return histogram;
+}
+
+bool ColumnHistogram::isSupported(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_TZ:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::optional<double> ColumnHistogram::toHistogramValue(const Value& value) {
+    if (value.isNull() || !isSupported(value.getDataType())) {
+        return std::nullopt;
+    }
+    switch (value.getDataType().getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+        return static_cast<double>(value.getValue<int64_t>());
+    case PhysicalTypeID::INT32:
+        return static_cast<double>(value.getValue<int32_t>());
+    case PhysicalTypeID::INT16:
+        return static_cast<double>(value.getValue<int16_t>());
+    case PhysicalTypeID::INT8:
+        return static_cast<double>(value.getValue<int8_t>());
+    case PhysicalTypeID::UINT64:
+        return static_cast<double>(value.getValue<uint64_t>());
+    case PhysicalTypeID::UINT32:
+        return static_cast<double>(value.getValue<uint32_t>());
+    case PhysicalTypeID::UINT16:
+        return static_cast<double>(value.getValue<uint16_t>());
+    case PhysicalTypeID::UINT8:
+        return static_cast<double>(value.getValue<uint8_t>());
+    case PhysicalTypeID::DOUBLE:
+        return value.getValue<double>();
+    case PhysicalTypeID::FLOAT:
+        return static_cast<double>(value.getValue<float>());
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+double ColumnHistogram::readValue(const ValueVector& vector, sel_t pos) {
+    KU_ASSERT(isSupported(vector.dataType) && !vector.isNull(pos));
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+        return static_cast<double>(vector.getValue<int64_t>(pos));
+    case PhysicalTypeID::INT32:
+        return static_cast<double>(vector.getValue<int32_t>(pos));
+    case PhysicalTypeID::INT16:
+        return static_cast<double>(vector.getValue<int16_t>(pos));
+    case PhysicalTypeID::INT8:
+        return static_cast<double>(vector.getValue<int8_t>(pos));
+    case PhysicalTypeID::UINT64:
+        return static_cast<double>(vector.getValue<uint64_t>(pos));
+    case PhysicalTypeID::UINT32:
+        return static_cast<double>(vector.getValue<uint32_t>(pos));
+    case PhysicalTypeID::UINT16:
+        return static_cast<double>(vector.getValue<uint16_t>(pos));
+    case PhysicalTypeID::UINT8:
+        return static_cast<double>(vector.getValue<uint8_t>(pos));
+    case PhysicalTypeID::DOUBLE:
+        return vector.getValue<double>(pos);
+    case PhysicalTypeID::FLOAT:
+        return static_cast<double>(vector.getValue<float>(pos));
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<typename T>
+static void sampleValues(const ValueVector& vector, StridedSample& sample) {
+    vector.state->getSelVector().forEach([&](auto pos) {
+        if (!vector.isNull(pos)) {
+            sample.append(static_cast<double>(vector.getValue<T>(pos)));
+        }
+    });
+}
+
+void ColumnHistogram::sampleVector(const ValueVector& vector, StridedSample& sample) {
+    KU_ASSERT(isSupported(vector.dataType));
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64: {
+        sampleValues<int64_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::INT32: {
+        sampleValues<int32_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::INT16: {
+        sampleValues<int16_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::INT8: {
+        sampleValues<int8_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::UINT64: {
+        sampleValues<uint64_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::UINT32: {
+        sampleValues<uint32_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::UINT16: {
+        sampleValues<uint16_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::UINT8: {
+        sampleValues<uint8_t>(vector, sample);
+    } break;
+    case PhysicalTypeID::DOUBLE: {
+        sampleValues<double>(vector, sample);
+    } break;
+    case PhysicalTypeID::FLOAT: {
+        sampleValues<float>(vector, sample);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+const ColumnHistogram::MostCommonValue* ColumnHistogram::findMostCommonValue(
+    double value) const {
+    auto it = std::lower_bound(mostCommonValues.begin(), mostCommonValues.end(), value,
+        [](const MostCommonValue& a, double b) { return a.value < b; });
+    return it != mostCommonValues.end() && it->value == value ? &*it : nullptr;
+}
+
+double ColumnHistogram::getMostCommonValuesCount() const {
+    double count = 0;
+    for (auto& mostCommonValue : mostCommonValues) {
+        count += mostCommonValue.count;
+    }
+    return count;
+}
+
+double ColumnHistogram::getBucketsCount() const {
+    double count = 0;
+    for (auto bucketCount : bucketCounts) {
+        count += bucketCount;
+    }
+    return count;
+}
+
+double ColumnHistogram::getNumValues() const {
+    return getMostCommonValuesCount() + getBucketsCount();
+}
+
+void ColumnHistogram::insert(const StridedSample& sample) {
+    const auto weight = sample.getWeight();
+    for (auto value : sample.getValues()) {
+        insert(value, weight);
+    }
+}
+
+void ColumnHistogram::insert(double value, double count) {
+    auto it = std::lower_bound(mostCommonValues.begin(), mostCommonValues.end(), value,
+        [](const MostCommonValue& a, double b) { return a.value < b; });
+    if (it != mostCommonValues.end() && it->value == value) {
+        it->count += count;
+        return;
+    }
+    if (bounds.empty()) {
+        bounds = {value, value};
+        bucketCounts = {count};
+        return;
+    }
+    // Out of range values widen the outermost bucket until it holds twice as many values as an
+    // average bucket, after which a new bucket is started. This keeps appends of increasing keys
+    // (timestamps, serials) from being smeared over one huge bucket.
+    const auto maxBucketCount = 2 * getBucketsCount() / bucketCounts.size();
+    if (value < bounds.front()) {
+        if (bucketCounts.front() + count > maxBucketCount) {
+            bounds.insert(bounds.begin(), value);
+            bucketCounts.insert(bucketCounts.begin(), count);
+            compactBuckets();
+            return;
+        }
+        bounds.front() = value;
+    } else if (value > bounds.back()) {
+        if (bucketCounts.back() + count > maxBucketCount) {
+            bounds.push_back(value);
+            bucketCounts.push_back(count);
+            compactBuckets();
+            return;
+        }
+        bounds.back() = value;
+    }
+    const auto upper = std::upper_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+    const auto bucketIdx = std::clamp<int64_t>(upper - 1, 0, bucketCounts.size() - 1);
+    bucketCounts[bucketIdx] += count;
+}
+
+void ColumnHistogram::compactBuckets() {
+    if (bucketCounts.size() <= 2 * HistogramConstants::NUM_BUCKETS) {
+        return;
+    }
+    // Merge pairs of adjacent buckets.
+    const auto numBuckets = bucketCounts.size();
+    for (auto i = 0u; i < numBuckets / 2; i++) {
+        bounds[i] = bounds[i * 2];
+        bucketCounts[i] = bucketCounts[i * 2] + bucketCounts[i * 2 + 1];
+    }
+    auto numMerged = numBuckets / 2;
+    if (numBuckets % 2 == 1) {
+        bounds[numMerged] = bounds[numBuckets - 1];
+        bucketCounts[numMerged] = bucketCounts[numBuckets - 1];
+        numMerged++;
+    }
+    bounds[numMerged] = bounds[numBuckets];
+    bounds.resize(numMerged + 1);
+    bucketCounts.resize(numMerged);
+}
+
+double ColumnHistogram::estimateEqualsFraction(double value,
+    cardinality_t numDistinctValues) const {
+    const auto numValues = getNumValues();
+    if (numValues == 0) {
+        return 0;
+    }
+    if (const auto mostCommonValue = findMostCommonValue(value)) {
+        return mostCommonValue->count / numValues;
+    }
+    if (bounds.empty() || value < bounds.front() || value > bounds.back()) {
+        return 0;
+    }
+    const auto numRemainingDistinct =
+        std::max<double>(1, static_cast<double>(numDistinctValues) - mostCommonValues.size());
+    return (numValues - getMostCommonValuesCount()) / numValues / numRemainingDistinct;
+}
+
+double ColumnHistogram::estimateLessThanFraction(double value, bool inclusive) const {
+    const auto numValues = getNumValues();
+    if (numValues == 0) {
+        return 0;
+    }
+    double count = 0;
+    for (auto& mostCommonValue : mostCommonValues) {
+        if (mostCommonValue.value < value || (inclusive && mostCommonValue.value == value)) {
+            count += mostCommonValue.count;
+        }
+    }
+    for (auto i = 0u; i < bucketCounts.size(); i++) {
+        const auto lower = bounds[i];
+        const auto upper = bounds[i + 1];
+        if (upper < value || (inclusive && upper == value)) {
+            count += bucketCounts[i];
+        } else if (lower < value) {
+            // Assume values are uniformly distributed within a bucket.
+            count += bucketCounts[i] * (value - lower) / (upper - lower);
+        }
+    }
+    return std::clamp(count / numValues, 0.0, 1.0);
+}
+
+double ColumnHistogram::estimateJoinSelectivity(const ColumnHistogram& other,
+    cardinality_t numDistinctValues, cardinality_t otherNumDistinctValues) const {
+    const auto numValues = getNumValues();
+    const auto otherNumValues = other.getNumValues();
+    if (numValues == 0 || otherNumValues == 0) {
+        return 0;
+    }
+    // Values present in both MCV lists join with their exact frequencies.
+    double selectivity = 0, matchedFraction = 0, otherMatchedFraction = 0;
+    uint64_t numMatched = 0;
+    auto it = mostCommonValues.begin();
+    auto otherIt = other.mostCommonValues.begin();
+    while (it != mostCommonValues.end() && otherIt != other.mostCommonValues.end()) {
+        if (it->value < otherIt->value) {
+            ++it;
+        } else if (otherIt->value < it->value) {
+            ++otherIt;
+        } else {
+            selectivity += (it->count / numValues) * (otherIt->count / otherNumValues);
+            matchedFraction += it->count / numValues;
+            otherMatchedFraction += otherIt->count / otherNumValues;
+            numMatched++;
+            ++it;
+            ++otherIt;
+        }
+    }
+    // A histogram without buckets lists all its values as MCVs, so its unmatched MCVs can only join
+    // with the bucketed values of the other side.
+    if (bounds.empty() || other.bounds.empty()) {
+        const auto& listed = bounds.empty() ? *this : other;
+        const auto& rest = bounds.empty() ? other : *this;
+        const auto listedNumValues = bounds.empty() ? numValues : otherNumValues;
+        const auto restNumDistinct = bounds.empty() ? otherNumDistinctValues : numDistinctValues;
+        for (auto& mostCommonValue : listed.mostCommonValues) {
+            if (rest.findMostCommonValue(mostCommonValue.value) == nullptr) {
+                selectivity += mostCommonValue.count / listedNumValues *
+                               rest.estimateEqualsFraction(mostCommonValue.value, restNumDistinct);
+            }
+        }
+        return selectivity;
+    }
+    // Columns whose value ranges do not overlap cannot join beyond their common MCVs.
+    auto getRange = [](const ColumnHistogram& histogram) {
+        auto min = std::numeric_limits<double>::max();
+        auto max = std::numeric_limits<double>::lowest();
+        if (!histogram.bounds.empty()) {
+            min = histogram.bounds.front();
+            max = histogram.bounds.back();
+        }
+        if (!histogram.mostCommonValues.empty()) {
+            min = std::min(min, histogram.mostCommonValues.front().value);
+            max = std::max(max, histogram.mostCommonValues.back().value);
+        }
+        return std::make_pair(min, max);
+    };
+    const auto [min, max] = getRange(*this);
+    const auto [otherMin, otherMax] = getRange(other);
+    if (max < otherMin || otherMax < min) {
+        return selectivity;
+    }
+    // The rest follows the usual containment assumption.
+    const auto numRemainingDistinct = std::max<double>(1,
+        static_cast<double>(std::max(numDistinctValues, otherNumDistinctValues)) - numMatched);
+    return selectivity +
+           (1 - matchedFraction) * (1 - otherMatchedFraction) / numRemainingDistinct;
+}
+
+void ColumnHistogram::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("most_common_values");
+    serializer.serializeVector(mostCommonValues);
+    serializer.writeDebuggingInfo("bounds");
+    serializer.serializeVector(bounds);
+    serializer.writeDebuggingInfo("bucket_counts");
+    serializer.serializeVector(bucketCounts);
+}
+
+ColumnHistogram ColumnHistogram::deserialize(Deserializer& deserializer) {
+    ColumnHistogram histogram;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "most_common_values");
+    deserializer.deserializeVector(histogram.mostCommonValues);
+    deserializer.validateDebuggingInfo(info, "bounds");
+    deserializer.deserializeVector(histogram.bounds);
+    deserializer.validateDebuggingInfo(info, "bucket_counts");
+    deserializer.deserializeVector(histogram.bucketCounts);
+    return histogram;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -20,12 +20,21 @@ void ColumnStats::update(const common::ValueVector* vector) {
         function::VectorHashFunction::computeHash(*vector, vector->state->getSelVector(), *hashes,
             hashes->state->getSelVector());
         KU_ASSERT(hashes->hasNoNullsGuarantee());
-        for (auto i = 0u; i < hashes->state->getSelVector().getSelSize(); i++) {
-            hll->insertElement(hashes->getValue<common::hash_t>(i));
-        }
+        // Hashes are written at the selected positions, which need not start at 0 (e.g. for a
+        // flat vector).
+        hashes->state->getSelVector().forEach(
+            [&](auto pos) { hll->insertElement(hashes->getValue<common::hash_t>(pos)); });
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
+    if (histogram) {
+        // Values can be folded in directly when this is the stats being maintained.
+        StridedSample sample;
+        ColumnHistogram::sampleVector(*vector, sample);
+        histogram->insert(sample);
+    } else if (ColumnHistogram::isSupported(vector->dataType)) {
+        ColumnHistogram::sampleVector(*vector, insertSample);
+    }
 }
 
 } // namespace storage
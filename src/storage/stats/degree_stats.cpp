@@ -0,0 +1,125 @@
+#include "storage/stats/degree_stats.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+idx_t DegreeStats::getBucketIdx(length_t degree) {
+    KU_ASSERT(degree > 0);
+    return std::min<idx_t>(std::bit_width(static_cast<uint64_t>(degree)) - 1, NUM_BUCKETS - 1);
+}
+
+void DegreeStats::add(length_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    const auto bucketIdx = getBucketIdx(degree);
+    bucketNumNodes[bucketIdx]++;
+    bucketSumDegrees[bucketIdx] += degree;
+}
+
+void DegreeStats::remove(length_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    const auto bucketIdx = getBucketIdx(degree);
+    KU_ASSERT(bucketNumNodes[bucketIdx] > 0 && bucketSumDegrees[bucketIdx] >= degree);
+    bucketNumNodes[bucketIdx]--;
+    bucketSumDegrees[bucketIdx] -= degree;
+}
+
+void DegreeStats::merge(const DegreeStats& other) {
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        bucketNumNodes[i] += other.bucketNumNodes[i];
+        bucketSumDegrees[i] += other.bucketSumDegrees[i];
+    }
+}
+
+uint64_t DegreeStats::getNumNodesWithRels() const {
+    uint64_t result = 0;
+    for (const auto numNodes : bucketNumNodes) {
+        result += numNodes;
+    }
+    return result;
+}
+
+uint64_t DegreeStats::getNumRels() const {
+    uint64_t result = 0;
+    for (const auto sumDegrees : bucketSumDegrees) {
+        result += sumDegrees;
+    }
+    return result;
+}
+
+double DegreeStats::getSkewDiscount(cardinality_t numBoundNodes, cardinality_t numNodes) const {
+    const auto numRels = getNumRels();
+    if (numRels == 0 || numNodes == 0) {
+        return 1.0;
+    }
+    // Collect hubs from the highest degree bucket downwards.
+    const auto maxNumHubNodes = static_cast<double>(getNumNodesWithRels()) * HUB_NODES_FRACTION;
+    uint64_t numHubNodes = 0;
+    uint64_t numHubRels = 0;
+    for (auto i = NUM_BUCKETS; i-- > 0;) {
+        if (bucketNumNodes[i] == 0) {
+            continue;
+        }
+        if (static_cast<double>(numHubNodes + bucketNumNodes[i]) > maxNumHubNodes) {
+            break;
+        }
+        numHubNodes += bucketNumNodes[i];
+        numHubRels += bucketSumDegrees[i];
+    }
+    // Stats can lag behind the node count, in which case there is no reliable non-hub average.
+    if (numHubNodes == 0 || numHubNodes >= numNodes) {
+        return 1.0;
+    }
+    const auto avgDegree = static_cast<double>(numRels) / static_cast<double>(numNodes);
+    // Hubs have the highest degrees, so this never exceeds the overall average.
+    const auto nonHubAvgDegree = static_cast<double>(numRels - numHubRels) /
+                                 static_cast<double>(numNodes - numHubNodes);
+    const auto hubHitProbability = std::min(1.0,
+        static_cast<double>(numBoundNodes) * numHubNodes / static_cast<double>(numNodes));
+    const auto typicalDegree =
+        nonHubAvgDegree + (avgDegree - nonHubAvgDegree) * hubHitProbability;
+    return std::clamp(typicalDegree / avgDegree, 0.0, 1.0);
+}
+
+void DegreeStats::serialize(Serializer& serializer) const {
+    // Only buckets up to the highest non-empty one are written, which are few for typical degrees.
+    uint8_t numBuckets = NUM_BUCKETS;
+    while (numBuckets > 0 && bucketNumNodes[numBuckets - 1] == 0) {
+        numBuckets--;
+    }
+    serializer.writeDebuggingInfo("num_buckets");
+    serializer.serializeValue(numBuckets);
+    serializer.writeDebuggingInfo("buckets");
+    for (auto i = 0u; i < numBuckets; i++) {
+        serializer.serializeValue(bucketNumNodes[i]);
+        serializer.serializeValue(bucketSumDegrees[i]);
+    }
+}
+
+DegreeStats DegreeStats::deserialize(Deserializer& deserializer) {
+    std::string info;
+    DegreeStats stats;
+    uint8_t numBuckets = 0;
+    deserializer.validateDebuggingInfo(info, "num_buckets");
+    deserializer.deserializeValue(numBuckets);
+    KU_ASSERT(numBuckets <= NUM_BUCKETS);
+    deserializer.validateDebuggingInfo(info, "buckets");
+    for (auto i = 0u; i < numBuckets; i++) {
+        deserializer.deserializeValue(stats.bucketNumNodes[i]);
+        deserializer.deserializeValue(stats.bucketSumDegrees[i]);
+    }
+    return stats;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -156,6 +156,7 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
 }
 
 bool StorageManager::checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
+    checkpointStats.reset();
     bool hasChanges = false;
     const auto catalog = Catalog::Get(*context);
     const auto nodeTableEntries = catalog->getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
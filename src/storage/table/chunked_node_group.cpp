@@ -541,6 +541,13 @@ void ChunkedNodeGroup::rollbackDelete(row_idx_t startRow, row_idx_t numRows_, tr
     versionInfo->rollbackDelete(startRow, numRows_);
 }
 
+void ChunkedNodeGroup::garbageCollectVersions(row_idx_t startRow, row_idx_t numRows_,
+    transaction_t) {
+    if (versionInfo && versionInfo->garbageCollect(startRow, numRows_)) {
+        versionInfo.reset();
+    }
+}
+
 void ChunkedNodeGroup::reclaimStorage(PageAllocator& pageAllocator) const {
     for (auto& columnChunk : chunks) {
         if (columnChunk) {
@@ -188,10 +188,12 @@ void ColumnChunk::update(const Transaction* transaction, offset_t offsetInChunk,
 
     const auto vectorIdx = offsetInChunk / DEFAULT_VECTOR_CAPACITY;
     const auto rowIdxInVector = offsetInChunk % DEFAULT_VECTOR_CAPACITY;
-    auto& vectorUpdateInfo = updateInfo.update(data.front()->getMemoryManager(), transaction,
-        vectorIdx, rowIdxInVector, values);
-    transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, vectorUpdateInfo,
-        transaction->getID());
+    auto [vectorUpdateInfo, isNewVersion] = updateInfo.update(data.front()->getMemoryManager(),
+        transaction, vectorIdx, rowIdxInVector, values);
+    if (isNewVersion) {
+        transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, *vectorUpdateInfo,
+            transaction->getID());
+    }
 }
 
 MergedColumnChunkStats ColumnChunk::getMergedColumnChunkStats() const {
@@ -461,6 +461,8 @@ void CSRNodeGroup::serialize(Serializer& serializer) {
     if (persistentChunkGroup) {
         serializer.writeDebuggingInfo("checkpointed_data");
         persistentChunkGroup->serialize(serializer);
+        serializer.writeDebuggingInfo("degree_stats");
+        degreeStats.serialize(serializer);
     }
 }
 
@@ -490,10 +492,34 @@ static std::unique_ptr<ChunkedCSRNodeGroup> createNewPersistentChunkGroup(
     return newGroup;
 }
 
+bool CSRNodeGroup::hasChangesToCheckpoint(const UniqLock& lock) const {
+    if (!chunkedGroups.isEmpty(lock) || persistentChunkGroup->hasUpdates()) {
+        return true;
+    }
+    return persistentChunkGroup->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0,
+               persistentChunkGroup->getNumRows()) > 0;
+}
+
+void CSRNodeGroup::checkpointWithoutDataChanges(CSRNodeGroupCheckpointState& csrState) {
+    // No csr regions need to be checkpointed, meaning nothing is updated or deleted.
+    // We should reset the version and update info of the persistent chunked group.
+    persistentChunkGroup->resetVersionAndUpdateInfo();
+    if (csrState.columnIDs.size() != persistentChunkGroup->getNumColumns()) {
+        // The column set of the node group has changed. We need to re-create the persistent
+        // chunked group.
+        persistentChunkGroup = createNewPersistentChunkGroup(
+            persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState);
+    }
+}
+
 void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheckpointState& state) {
-    // TODO(Guodong): Should skip early here if no changes in the node group, so we avoid scanning
-    // the csr header. Case: No insertions/deletions in persistent chunk and no in-mem chunks.
     auto& csrState = state.cast<CSRNodeGroupCheckpointState>();
+    if (!hasChangesToCheckpoint(lock)) {
+        // Skip scanning the csr header if there are no insertions, deletions or updates.
+        checkpointWithoutDataChanges(csrState);
+        csrState.stats.numCSRNodeGroupsSkipped++;
+        return;
+    }
     // Scan old csr header from disk and construct new csr header.
     persistentChunkGroup->cast<ChunkedCSRNodeGroup>().scanCSRHeader(*state.mm, csrState);
     csrState.newHeader =
@@ -506,19 +532,13 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
         [](const auto& a, const auto& b) { return a.regionIdx < b.regionIdx; }));
     const auto regionsToCheckpoint = mergeRegionsToCheckpoint(csrState, leafRegions);
     if (regionsToCheckpoint.empty()) {
-        // No csr regions need to be checkpointed, meaning nothing is updated or deleted.
-        // We should reset the version and update info of the persistent chunked group.
-        persistentChunkGroup->resetVersionAndUpdateInfo();
-        if (csrState.columnIDs.size() != persistentChunkGroup->getNumColumns()) {
-            // The column set of the node group has changed. We need to re-create the persistent
-            // chunked group.
-            persistentChunkGroup = createNewPersistentChunkGroup(
-                persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState);
-        }
+        checkpointWithoutDataChanges(csrState);
         return;
     }
-    if (regionsToCheckpoint.size() == 1 &&
-        regionsToCheckpoint[0].level > DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight) {
+    const auto needRedistribution =
+        regionsToCheckpoint.size() == 1 &&
+        regionsToCheckpoint[0].level > DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight;
+    if (needRedistribution) {
         // Need to re-distribute all CSR regions in the node group.
         redistributeCSRRegions(csrState, leafRegions);
     } else {
@@ -532,20 +552,28 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
     }
 
     uint64_t numTuplesAfterCheckpoint = 0;
+    // CSR lengths can only change within the regions to checkpoint.
+    auto newDegreeStats = degreeStats;
     for (const auto& region : regionsToCheckpoint) {
         for (auto i = region.leftNodeOffset; i <= region.rightNodeOffset; ++i) {
-            numTuplesAfterCheckpoint += csrState.newHeader->getCSRLength(i);
+            const auto newLength = csrState.newHeader->getCSRLength(i);
+            numTuplesAfterCheckpoint += newLength;
+            newDegreeStats.remove(csrState.oldHeader->getCSRLength(i));
+            newDegreeStats.add(newLength);
         }
     }
     if (numTuplesAfterCheckpoint == 0) {
         reclaimStorage(csrState.pageAllocator, lock);
         persistentChunkGroup = nullptr;
+        degreeStats = DegreeStats{};
     } else {
+        degreeStats = newDegreeStats;
         KU_ASSERT(csrState.newHeader->sanityCheck());
         for (const auto columnID : csrState.columnIDs) {
             checkpointColumn(lock, columnID, csrState, regionsToCheckpoint);
         }
-        checkpointCSRHeaderColumns(csrState);
+        checkpointCSRHeaderColumns(csrState, regionsToCheckpoint, needRedistribution);
+        csrState.stats.numCSRRegionsCheckpointed += regionsToCheckpoint.size();
         persistentChunkGroup = createNewPersistentChunkGroup(
             persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState);
     }
@@ -593,6 +621,7 @@ void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
         // the region, but keep deleted rows as gaps. This can happen when all rows are deleted
         // within the region.
         for (auto& regionCheckpointState : regionCheckpointStates) {
+            csrState.stats.numCSRBytesWritten += regionCheckpointState.chunkData->getSizeOnDisk();
             chunkCheckpointStates.push_back(std::move(regionCheckpointState));
         }
     }
@@ -874,21 +903,50 @@ std::vector<ChunkCheckpointState> CSRNodeGroup::checkpointColumnInRegion(const U
     return ret;
 }
 
-void CSRNodeGroup::checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const {
+static ChunkCheckpointState sliceCSRHeaderChunk(MemoryManager& memoryManager,
+    const ColumnChunkData& headerChunk, offset_t startNodeOffset, offset_t numNodes) {
+    auto slice = ColumnChunkFactory::createColumnChunkData(memoryManager,
+        headerChunk.getDataType().copy(), false /*enableCompression*/, numNodes,
+        ResidencyState::IN_MEMORY, false /*hasNullData*/);
+    slice->append(&headerChunk, startNodeOffset, numNodes);
+    return ChunkCheckpointState{std::move(slice), startNodeOffset, numNodes};
+}
+
+void CSRNodeGroup::checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState,
+    const std::vector<CSRRegion>& regions, bool rewriteAll) const {
+    auto& persistentHeader = persistentChunkGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
     std::vector<ChunkCheckpointState> csrOffsetChunkCheckpointStates;
+    std::vector<ChunkCheckpointState> csrLengthChunkCheckpointStates;
     const auto numNodes = csrState.newHeader->offset->getNumValues();
     KU_ASSERT(numNodes == csrState.newHeader->length->getNumValues());
-    csrOffsetChunkCheckpointStates.push_back(
-        ChunkCheckpointState{std::move(csrState.newHeader->offset), 0, numNodes});
-    persistentChunkGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader().offset->checkpoint(
-        *csrState.csrOffsetColumn, std::move(csrOffsetChunkCheckpointStates),
-        csrState.pageAllocator);
-    std::vector<ChunkCheckpointState> csrLengthChunkCheckpointStates;
-    csrLengthChunkCheckpointStates.push_back(
-        ChunkCheckpointState{std::move(csrState.newHeader->length), 0, numNodes});
-    persistentChunkGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader().length->checkpoint(
-        *csrState.csrLengthColumn, std::move(csrLengthChunkCheckpointStates),
-        csrState.pageAllocator);
+    // Offsets and lengths outside of the checkpointed regions are unchanged, so we only write the
+    // slices of the header covered by the regions. This relies on the persistent header already
+    // covering all nodes in the new header, otherwise we rewrite the whole header.
+    if (!rewriteAll && persistentHeader.offset->getNumValues() >= numNodes &&
+        persistentHeader.length->getNumValues() >= numNodes) {
+        for (const auto& region : regions) {
+            const auto numNodesInRegion = region.rightNodeOffset - region.leftNodeOffset + 1;
+            csrOffsetChunkCheckpointStates.push_back(sliceCSRHeaderChunk(*csrState.mm,
+                *csrState.newHeader->offset, region.leftNodeOffset, numNodesInRegion));
+            csrLengthChunkCheckpointStates.push_back(sliceCSRHeaderChunk(*csrState.mm,
+                *csrState.newHeader->length, region.leftNodeOffset, numNodesInRegion));
+        }
+    } else {
+        csrOffsetChunkCheckpointStates.push_back(
+            ChunkCheckpointState{std::move(csrState.newHeader->offset), 0, numNodes});
+        csrLengthChunkCheckpointStates.push_back(
+            ChunkCheckpointState{std::move(csrState.newHeader->length), 0, numNodes});
+    }
+    for (const auto& chunkCheckpointState : csrOffsetChunkCheckpointStates) {
+        csrState.stats.numCSRBytesWritten += chunkCheckpointState.chunkData->getSizeOnDisk();
+    }
+    for (const auto& chunkCheckpointState : csrLengthChunkCheckpointStates) {
+        csrState.stats.numCSRBytesWritten += chunkCheckpointState.chunkData->getSizeOnDisk();
+    }
+    persistentHeader.offset->checkpoint(*csrState.csrOffsetColumn,
+        std::move(csrOffsetChunkCheckpointStates), csrState.pageAllocator);
+    persistentHeader.length->checkpoint(*csrState.csrLengthColumn,
+        std::move(csrLengthChunkCheckpointStates), csrState.pageAllocator);
 }
 
 void CSRNodeGroup::collectRegionChangesAndUpdateHeaderLength(const UniqLock& lock,
@@ -1002,6 +1060,10 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
     populateCSRLengthInMemOnly(lock, numNodes, csrState);
+    degreeStats = DegreeStats{};
+    for (auto offset = 0u; offset < numNodes; offset++) {
+        degreeStats.add(csrState.newHeader->getCSRLength(offset));
+    }
     const auto rightCSROffsetsOfRegions =
         csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
@@ -1086,8 +1148,12 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     // FIXME(bmwinger): this needs segmentation. Maybe this should use (or share code with)
     // checkpointOutOfPlace Flush data chunks to disk.
     for (const auto& chunk : dataChunksToFlush) {
+        csrState.stats.numCSRBytesWritten += chunk->getSizeOnDisk();
         chunk->flush(csrState.pageAllocator);
     }
+    csrState.stats.numCSRBytesWritten +=
+        csrState.newHeader->offset->getSizeOnDisk() + csrState.newHeader->length->getSizeOnDisk();
+    csrState.stats.numCSRRegionsCheckpointed += rightCSROffsetsOfRegions.size();
     csrState.newHeader->offset->flush(csrState.pageAllocator);
     csrState.newHeader->length->flush(csrState.pageAllocator);
     persistentChunkGroup = std::make_unique<ChunkedCSRNodeGroup>(
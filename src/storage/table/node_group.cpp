@@ -613,8 +613,12 @@ std::unique_ptr<NodeGroup> NodeGroup::deserialize(MemoryManager& mm, Deserialize
     case NodeGroupDataFormat::CSR: {
         if (hasCheckpointedData) {
             chunkedNodeGroup = ChunkedCSRNodeGroup::deserialize(mm, deSer);
-            return std::make_unique<CSRNodeGroup>(mm, nodeGroupIdx, enableCompression,
+            deSer.validateDebuggingInfo(key, "degree_stats");
+            auto degreeStats = DegreeStats::deserialize(deSer);
+            auto nodeGroup = std::make_unique<CSRNodeGroup>(mm, nodeGroupIdx, enableCompression,
                 std::move(chunkedNodeGroup));
+            nodeGroup->setDegreeStats(degreeStats);
+            return nodeGroup;
         } else {
             return std::make_unique<CSRNodeGroup>(mm, nodeGroupIdx, enableCompression,
                 copyVector(columnTypes));
@@ -497,6 +497,9 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        if (transaction->isWriteTransaction()) {
+            transaction->getLocalStorage()->markCommittedRowsChanged(tableID);
+        }
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -533,6 +536,9 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         if (transaction->shouldAppendToUndoBuffer()) {
             transaction->pushDeleteInfo(nodeGroupIdx, rowIdxInGroup, 1, &versionRecordHandler);
         }
+        if (isDeleted && transaction->isWriteTransaction()) {
+            transaction->getLocalStorage()->markCommittedRowsChanged(tableID);
+        }
     }
     if (isDeleted) {
         hasChanges = true;
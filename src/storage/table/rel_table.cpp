@@ -228,6 +228,9 @@ void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
                 relUpdateState.getBoundNodeIDVector(relData->getDirection()),
                 relUpdateState.relIDVector, relUpdateState.columnID, relUpdateState.propertyVector);
         }
+        if (transaction->isWriteTransaction()) {
+            transaction->getLocalStorage()->markCommittedRowsChanged(tableID);
+        }
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -258,6 +261,9 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
                 break;
             }
         }
+        if (isDeleted && transaction->isWriteTransaction()) {
+            transaction->getLocalStorage()->markCommittedRowsChanged(tableID);
+        }
     }
     if (isDeleted) {
         hasChanges = true;
@@ -360,6 +366,9 @@ void RelTable::detachDeleteForCSRRels(Transaction* transaction, RelTableData* ta
             }
             [[maybe_unused]] const auto deleted = tableData->delete_(transaction,
                 deleteState->srcNodeIDVector, deleteState->relIDVector);
+            if (transaction->isWriteTransaction()) {
+                transaction->getLocalStorage()->markCommittedRowsChanged(tableID);
+            }
             if (reverseTableData) {
                 [[maybe_unused]] const auto reverseDeleted = reverseTableData->delete_(transaction,
                     deleteState->dstNodeIDVector, deleteState->relIDVector);
@@ -501,7 +510,7 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction,
     }
 }
 
-bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
+bool RelTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tableEntry,
     PageAllocator& pageAllocator) {
     bool ret = hasChanges;
     if (hasChanges) {
@@ -511,8 +520,9 @@ bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
         for (auto& property : tableEntry->getProperties()) {
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
+        auto& checkpointStats = StorageManager::Get(*context)->getCheckpointStats();
         for (auto& directedRelData : directedRelData) {
-            directedRelData->checkpoint(columnIDs, pageAllocator);
+            directedRelData->checkpoint(columnIDs, pageAllocator, checkpointStats);
         }
         hasChanges = false;
     }
@@ -243,7 +243,7 @@ void RelTableData::pushInsertInfo(const Transaction* transaction, const CSRNodeG
 }
 
 void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
-    PageAllocator& pageAllocator) {
+    PageAllocator& pageAllocator, CheckpointStats& stats) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -257,7 +257,7 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
     }
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
-        csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+        csrHeaderColumns.offset.get(), csrHeaderColumns.length.get(), stats};
     nodeGroups->checkpoint(*mm, state);
 }
 
@@ -284,6 +284,14 @@ void RelTableData::rollbackGroupCollectionInsert(row_idx_t numRows_, bool isPers
     nodeGroups->rollbackInsert(numRows_, !isPersistent);
 }
 
+DegreeStats RelTableData::getDegreeStats() const {
+    DegreeStats degreeStats;
+    for (auto i = 0u; i < getNumNodeGroups(); i++) {
+        degreeStats.merge(getNodeGroup(i)->cast<CSRNodeGroup>().getDegreeStats());
+    }
+    return degreeStats;
+}
+
 void RelTableData::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
 }
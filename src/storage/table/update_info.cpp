@@ -14,8 +14,9 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transaction* transaction,
-    const idx_t vectorIdx, const sel_t rowIdxInVector, const ValueVector& values) {
+std::pair<VectorUpdateInfo*, bool> UpdateInfo::update(MemoryManager& memoryManager,
+    const Transaction* transaction, const idx_t vectorIdx, const sel_t rowIdxInVector,
+    const ValueVector& values) {
     UpdateNode& header = getOrCreateUpdateNode(vectorIdx);
     // We always lock the head of the chain of vectorUpdateInfo to ensure that we can safely
     // read/write to any part of the chain.
@@ -32,15 +33,14 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
         } else if (current->version > transaction->getStartTS()) {
             // Potentially there can be conflicts. `current` can be uncommitted transaction (version
             // is transaction ID) or committed transaction started after this transaction.
-            for (auto i = 0u; i < current->numRowsUpdated; i++) {
-                if (current->rowsInVector[i] == rowIdxInVector) {
-                    throw RuntimeException("Write-write conflict of updating the same row.");
-                }
+            if (current->rowsUpdatedMask[rowIdxInVector]) {
+                throw RuntimeException("Write-write conflict of updating the same row.");
             }
         }
         current = current->prev.get();
     }
-    if (!vecUpdateInfo) {
+    const bool isNewVersion = vecUpdateInfo == nullptr;
+    if (isNewVersion) {
         // Create a new version here if not found in the chain.
         auto newInfo = std::make_unique<VectorUpdateInfo>(memoryManager, transaction->getID(),
             values.dataType.copy());
@@ -53,24 +53,25 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
         header.info = std::move(newInfo);
     }
     KU_ASSERT(vecUpdateInfo);
-    // Check if the row is already updated in this transaction.
-    idx_t idxInUpdateData = INVALID_IDX;
-    for (auto i = 0u; i < vecUpdateInfo->numRowsUpdated; i++) {
-        if (vecUpdateInfo->rowsInVector[i] == rowIdxInVector) {
-            idxInUpdateData = i;
-            break;
+    if (vecUpdateInfo->rowsUpdatedMask[rowIdxInVector]) {
+        // The row is already updated in this transaction. Overwrite existing update value.
+        idx_t idxInUpdateData = INVALID_IDX;
+        for (auto i = 0u; i < vecUpdateInfo->numRowsUpdated; i++) {
+            if (vecUpdateInfo->rowsInVector[i] == rowIdxInVector) {
+                idxInUpdateData = i;
+                break;
+            }
         }
-    }
-    if (idxInUpdateData != INVALID_IDX) {
-        // Overwrite existing update value.
+        KU_ASSERT(idxInUpdateData != INVALID_IDX);
         vecUpdateInfo->data->write(&values, values.state->getSelVector()[0], idxInUpdateData);
     } else {
         // Append new value and update `rowsInVector`.
         vecUpdateInfo->rowsInVector[vecUpdateInfo->numRowsUpdated] = rowIdxInVector;
+        vecUpdateInfo->rowsUpdatedMask[rowIdxInVector] = true;
         vecUpdateInfo->data->write(&values, values.state->getSelVector()[0],
             vecUpdateInfo->numRowsUpdated++);
     }
-    return *vecUpdateInfo;
+    return {vecUpdateInfo, isNewVersion};
 }
 
 void UpdateInfo::scan(const Transaction* transaction, ValueVector& output, offset_t offsetInChunk,
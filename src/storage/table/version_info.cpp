@@ -1,5 +1,7 @@
 #include "storage/table/version_info.h"
 
+#include <algorithm>
+
 #include "common/exception/runtime.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
@@ -59,6 +61,10 @@ struct VectorVersionInfo {
     row_idx_t getNumDeletions(transaction_t startTS, transaction_t transactionID,
         row_idx_t startRow, length_t numRows) const;
 
+    // Drops insertion versions if all of them are committed. Returns true if the vector has no
+    // versions left to check, i.e., all its rows are visible to all transactions.
+    bool garbageCollect();
+
     void serialize(Serializer& serializer) const;
     static std::unique_ptr<VectorVersionInfo> deSerialize(Deserializer& deSer);
 
@@ -72,6 +78,12 @@ private:
 
 void VectorVersionInfo::append(const transaction_t transactionID, const row_idx_t startRow,
     const row_idx_t numRows) {
+    if (insertionStatus != InsertionStatus::CHECK_VERSION && startRow > 0) {
+        // Rows before `startRow` have no insertion versions (they are checkpointed or their
+        // versions are garbage collected), thus they are visible to all transactions.
+        initInsertionVersionArray();
+        std::fill_n(insertedVersions->begin(), startRow, 0);
+    }
     insertionStatus = InsertionStatus::CHECK_VERSION;
     if (transactionID == sameInsertionVersion) {
         return;
@@ -159,18 +171,33 @@ bool VectorVersionInfo::isSelected(const transaction_t startTS, const transactio
     return false;
 }
 
+static void selectAllRows(SelectionVector& selVector, row_idx_t numRows, sel_t startOutputPos) {
+    auto numSelected = selVector.getSelSize();
+    if (selVector.isUnfiltered()) {
+        selVector.setSelSize(numSelected + numRows);
+    } else {
+        for (auto i = 0u; i < numRows; i++) {
+            selVector.getMutableBuffer()[numSelected++] = startOutputPos + i;
+        }
+        selVector.setToFiltered(numSelected);
+    }
+}
+
 void VectorVersionInfo::getSelVectorForScan(const transaction_t startTS,
     const transaction_t transactionID, SelectionVector& selVector, const row_idx_t startRow,
     const row_idx_t numRows, sel_t startOutputPos) const {
     auto numSelected = selVector.getSelSize();
     if (deletionStatus == DeletionStatus::NO_DELETED &&
         insertionStatus == InsertionStatus::ALWAYS_INSERTED) {
-        if (selVector.isUnfiltered()) {
-            selVector.setSelSize(selVector.getSelSize() + numRows);
-        } else {
-            for (auto i = 0u; i < numRows; i++) {
-                selVector.getMutableBuffer()[numSelected++] = startOutputPos + i;
-            }
+        selectAllRows(selVector, numRows, startOutputPos);
+    } else if (deletionStatus == DeletionStatus::NO_DELETED && isSameInsertionVersion()) {
+        // All rows share the same insertion version, so visibility is decided once for the vector.
+        KU_ASSERT(insertionStatus == InsertionStatus::CHECK_VERSION);
+        if (sameInsertionVersion == transactionID || sameInsertionVersion <= startTS) {
+            selectAllRows(selVector, numRows, startOutputPos);
+        } else if (selVector.isUnfiltered()) {
+            // Keep the buffer consistent with the rows selected so far.
+            selVector.makeDynamic();
             selVector.setToFiltered(numSelected);
         }
     } else if (insertionStatus != InsertionStatus::NO_INSERTED) {
@@ -252,6 +279,29 @@ row_idx_t VectorVersionInfo::getNumDeletions(transaction_t startTS, transaction_
     return numDeletions;
 }
 
+bool VectorVersionInfo::garbageCollect() {
+    if (insertionStatus == InsertionStatus::CHECK_VERSION) {
+        if (isSameInsertionVersion()) {
+            if (sameInsertionVersion >= transaction::Transaction::START_TRANSACTION_ID) {
+                return false;
+            }
+        } else {
+            KU_ASSERT(insertedVersions);
+            for (const auto version : *insertedVersions) {
+                if (version != INVALID_TRANSACTION &&
+                    version >= transaction::Transaction::START_TRANSACTION_ID) {
+                    return false;
+                }
+            }
+        }
+        insertedVersions.reset();
+        sameInsertionVersion = INVALID_TRANSACTION;
+        insertionStatus = InsertionStatus::ALWAYS_INSERTED;
+    }
+    return insertionStatus == InsertionStatus::ALWAYS_INSERTED &&
+           deletionStatus == DeletionStatus::NO_DELETED;
+}
+
 void VectorVersionInfo::rollbackInsertions(row_idx_t startRowInVector, row_idx_t numRows) {
     if (isSameInsertionVersion()) {
         // This implicitly assumes that all rows are inserted in the same transaction, so regardless
@@ -509,6 +559,21 @@ void VersionInfo::getSelVectorToScan(const transaction_t startTS, const transact
     KU_ASSERT(outputPos <= DEFAULT_VECTOR_CAPACITY);
 }
 
+bool VersionInfo::garbageCollect(row_idx_t startRow, row_idx_t numRows) {
+    if (numRows > 0) {
+        const auto startVectorIdx = startRow / DEFAULT_VECTOR_CAPACITY;
+        const auto endVectorIdx = (startRow + numRows - 1) / DEFAULT_VECTOR_CAPACITY;
+        for (auto vectorIdx = startVectorIdx;
+             vectorIdx <= endVectorIdx && vectorIdx < vectorsInfo.size(); vectorIdx++) {
+            if (vectorsInfo[vectorIdx] && vectorsInfo[vectorIdx]->garbageCollect()) {
+                vectorsInfo[vectorIdx] = nullptr;
+            }
+        }
+    }
+    return std::ranges::all_of(vectorsInfo,
+        [](const auto& vectorInfo) { return vectorInfo == nullptr; });
+}
+
 void VersionInfo::clearVectorInfo(const idx_t vectorIdx) {
     KU_ASSERT(vectorIdx < vectorsInfo.size());
     vectorsInfo[vectorIdx] = nullptr;
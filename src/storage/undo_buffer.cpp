@@ -168,6 +168,15 @@ void UndoBuffer::commit(transaction_t commitTS) const {
     });
 }
 
+void UndoBuffer::garbageCollectVersions() const {
+    UndoBufferIterator iterator{*this};
+    iterator.iterate([&](UndoRecordType entryType, uint8_t const* entry) {
+        if (entryType == UndoRecordType::INSERT_INFO || entryType == UndoRecordType::DELETE_INFO) {
+            garbageCollectVersionInfo(entry);
+        }
+    });
+}
+
 void UndoBuffer::rollback(ClientContext* context) const {
     UndoBufferIterator iterator{*this};
     iterator.reverseIterate([&](UndoRecordType entryType, uint8_t const* entry) {
@@ -221,6 +230,13 @@ void UndoBuffer::commitVersionInfo(UndoRecordType recordType, const uint8_t* rec
     }
 }
 
+void UndoBuffer::garbageCollectVersionInfo(const uint8_t* record) {
+    const auto& undoRecord = *reinterpret_cast<VersionRecord const*>(record);
+    undoRecord.versionRecordHandler->applyFuncToChunkedGroups(
+        &ChunkedNodeGroup::garbageCollectVersions, undoRecord.nodeGroupIdx, undoRecord.startRow,
+        undoRecord.numRows, INVALID_TRANSACTION);
+}
+
 void UndoBuffer::commitVectorUpdateInfo(const uint8_t* record, transaction_t commitTS) {
     auto& undoRecord = *reinterpret_cast<VectorUpdateRecord const*>(record);
     KU_ASSERT(undoRecord.updateInfo);
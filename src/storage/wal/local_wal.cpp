@@ -2,8 +2,10 @@
 
 #include "binder/ddl/bound_alter_info.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
+#include "common/serializer/buffer_writer.h"
 #include "common/serializer/in_mem_file_writer.h"
 #include "common/vector/value_vector.h"
+#include "lz4.hpp"
 #include "storage/wal/checksum_writer.h"
 
 using namespace kuzu::catalog;
@@ -13,10 +15,15 @@ using namespace kuzu::binder;
 namespace kuzu {
 namespace storage {
 
-LocalWAL::LocalWAL(MemoryManager& mm, bool enableChecksums)
+// Smaller records (e.g. single row updates) are not worth compressing.
+static constexpr uint64_t MIN_RECORD_SIZE_TO_COMPRESS = 1024;
+
+LocalWAL::LocalWAL(MemoryManager& mm, bool enableChecksums, bool enableCompression)
     : inMemWriter(std::make_shared<InMemFileWriter>(mm)),
       serializer(enableChecksums ? std::make_shared<ChecksumWriter>(inMemWriter, mm) :
-                                   std::static_pointer_cast<Writer>(inMemWriter)) {}
+                                   std::static_pointer_cast<Writer>(inMemWriter)),
+      enableCompression{enableCompression}, recordWriter{std::make_shared<BufferWriter>()},
+      recordSerializer{recordWriter} {}
 
 void LocalWAL::logBeginTransaction() {
     BeginTransactionRecord walRecord;
@@ -93,6 +100,7 @@ void LocalWAL::logLoadExtension(std::string path) {
 void LocalWAL::clear() {
     std::unique_lock lck{mtx};
     serializer.getWriter()->clear();
+    compressionStats = WALCompressionStats{};
 }
 
 uint64_t LocalWAL::getSize() {
@@ -105,9 +113,48 @@ void LocalWAL::addNewWALRecord(const WALRecord& walRecord) {
     std::unique_lock lck{mtx};
     KU_ASSERT(walRecord.type != WALRecordType::INVALID_RECORD);
     serializer.getWriter()->onObjectBegin();
-    walRecord.serialize(serializer);
+    const auto sizeBefore = serializer.getWriter()->getSize();
+    if (enableCompression) {
+        // Serialize the record once into the scratch buffer, then write either its bytes or their
+        // compressed form.
+        recordWriter->clear();
+        walRecord.serialize(recordSerializer);
+        const auto recordSize = recordWriter->getSize();
+        compressionStats.numBytesBeforeCompression += recordSize;
+        if (!tryWriteCompressed(recordWriter->getBlobData(), recordSize)) {
+            serializer.write(recordWriter->getBlobData(), recordSize);
+        }
+    } else {
+        walRecord.serialize(serializer);
+        compressionStats.numBytesBeforeCompression +=
+            serializer.getWriter()->getSize() - sizeBefore;
+    }
+    compressionStats.numBytesAfterCompression += serializer.getWriter()->getSize() - sizeBefore;
     serializer.getWriter()->onObjectEnd();
 }
 
+bool LocalWAL::tryWriteCompressed(const uint8_t* data, uint64_t size) {
+    if (size < MIN_RECORD_SIZE_TO_COMPRESS || size > LZ4_MAX_INPUT_SIZE) {
+        return false;
+    }
+    const auto maxCompressedSize = kuzu_lz4::LZ4_compressBound(size);
+    if (compressionBuffer.size() < static_cast<uint64_t>(maxCompressedSize)) {
+        compressionBuffer.resize(maxCompressedSize);
+    }
+    const auto compressedSize = kuzu_lz4::LZ4_compress_default(reinterpret_cast<const char*>(data),
+        reinterpret_cast<char*>(compressionBuffer.data()), size, maxCompressedSize);
+    if (compressedSize <= 0 || static_cast<uint64_t>(compressedSize) >= size) {
+        return false;
+    }
+    CompressedRecord{size, static_cast<uint64_t>(compressedSize), compressionBuffer.data()}
+        .serialize(serializer);
+    return true;
+}
+
+WALCompressionStats LocalWAL::getCompressionStats() {
+    std::unique_lock lck{mtx};
+    return compressionStats;
+}
+
 } // namespace storage
 } // namespace kuzu
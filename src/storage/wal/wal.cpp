@@ -34,6 +34,9 @@ void WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
     initWriter(context);
     localWAL.inMemWriter->flush(*serializer->getWriter());
     flushAndSyncNoLock();
+    const auto localStats = localWAL.getCompressionStats();
+    compressionStats.numBytesBeforeCompression += localStats.numBytesBeforeCompression;
+    compressionStats.numBytesAfterCompression += localStats.numBytesAfterCompression;
 }
 
 void WAL::logAndFlushCheckpoint(main::ClientContext* context) {
@@ -63,6 +66,11 @@ void WAL::flushAndSyncNoLock() {
     serializer->getWriter()->sync();
 }
 
+WALCompressionStats WAL::getCompressionStats() {
+    std::unique_lock lck{mtx};
+    return compressionStats;
+}
+
 uint64_t WAL::getFileSize() {
     std::unique_lock lck{mtx};
     return serializer->getWriter()->getSize();
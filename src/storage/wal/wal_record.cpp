@@ -2,9 +2,11 @@
 
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "common/exception/runtime.h"
+#include "common/serializer/buffer_reader.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "main/client_context.h"
+#include "lz4.hpp"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::common;
@@ -72,6 +74,12 @@ std::unique_ptr<WALRecord> WALRecord::deserialize(Deserializer& deserializer,
     case WALRecordType::LOAD_EXTENSION_RECORD: {
         walRecord = LoadExtensionRecord::deserialize(deserializer);
     } break;
+    case WALRecordType::COMPRESSED_RECORD: {
+        // Return the wrapped record as is.
+        walRecord = CompressedRecord::deserialize(deserializer, clientContext);
+        deserializer.getReader()->onObjectEnd();
+        return walRecord;
+    }
     case WALRecordType::INVALID_RECORD: {
         throw RuntimeException("Corrupted wal file. Read out invalid WAL record type.");
     }
@@ -482,5 +490,41 @@ std::unique_ptr<LoadExtensionRecord> LoadExtensionRecord::deserialize(Deserializ
     return std::make_unique<LoadExtensionRecord>(std::move(path));
 }
 
+void CompressedRecord::serialize(Serializer& serializer) const {
+    WALRecord::serialize(serializer);
+    serializer.writeDebuggingInfo("uncompressed_size");
+    serializer.write<uint64_t>(uncompressedSize);
+    serializer.writeDebuggingInfo("compressed_size");
+    serializer.write<uint64_t>(compressedSize);
+    serializer.write(compressedData, compressedSize);
+}
+
+std::unique_ptr<WALRecord> CompressedRecord::deserialize(Deserializer& deserializer,
+    const main::ClientContext& clientContext) {
+    std::string key;
+    uint64_t uncompressedSize = 0;
+    uint64_t compressedSize = 0;
+    deserializer.validateDebuggingInfo(key, "uncompressed_size");
+    deserializer.deserializeValue<uint64_t>(uncompressedSize);
+    deserializer.validateDebuggingInfo(key, "compressed_size");
+    deserializer.deserializeValue<uint64_t>(compressedSize);
+    if (uncompressedSize > LZ4_MAX_INPUT_SIZE ||
+        compressedSize > static_cast<uint64_t>(kuzu_lz4::LZ4_compressBound(uncompressedSize))) {
+        throw RuntimeException("Corrupted wal file. Read out invalid compressed WAL record.");
+    }
+    const auto compressedData = std::make_unique<uint8_t[]>(compressedSize);
+    deserializer.read(compressedData.get(), compressedSize);
+    const auto uncompressedData = std::make_unique<uint8_t[]>(uncompressedSize);
+    const auto decompressedSize =
+        kuzu_lz4::LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.get()),
+            reinterpret_cast<char*>(uncompressedData.get()), compressedSize, uncompressedSize);
+    if (decompressedSize < 0 || static_cast<uint64_t>(decompressedSize) != uncompressedSize) {
+        throw RuntimeException("Corrupted wal file. Failed to decompress WAL record.");
+    }
+    Deserializer recordDeserializer{
+        std::make_unique<BufferReader>(uncompressedData.get(), uncompressedSize)};
+    return WALRecord::deserialize(recordDeserializer, clientContext);
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,93 @@
+#include "transaction/background_checkpointer.h"
+
+#include "common/constants.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace transaction {
+
+static constexpr auto IDLE_TIME =
+    std::chrono::microseconds(BACKGROUND_CHECKPOINT_IDLE_TIME_IN_MICROS);
+
+BackgroundCheckpointer::BackgroundCheckpointer(main::Database& database)
+    : database{database}, stopped{false}, numCommits{0}, numCommitsCheckpointed{0},
+      numCommitsWhenThresholdExceeded{0} {}
+
+BackgroundCheckpointer::~BackgroundCheckpointer() {
+    stop();
+}
+
+void BackgroundCheckpointer::notifyCommit(bool walExceedsThreshold) {
+    std::unique_lock lck{mtx};
+    if (stopped) {
+        return;
+    }
+    numCommits++;
+    lastCommitTime = std::chrono::steady_clock::now();
+    if (walExceedsThreshold) {
+        numCommitsWhenThresholdExceeded = numCommits;
+    }
+    if (!thread.joinable()) {
+        thread = std::thread([this]() { run(); });
+    }
+    if (walExceedsThreshold) {
+        cv.notify_one();
+    }
+}
+
+void BackgroundCheckpointer::stop() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+    }
+    cv.notify_one();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void BackgroundCheckpointer::run() {
+    std::unique_lock lck{mtx};
+    while (!stopped) {
+        const auto thresholdExceeded = [&]() {
+            return numCommitsWhenThresholdExceeded > numCommitsCheckpointed;
+        };
+        cv.wait_for(lck, IDLE_TIME, [&]() { return stopped || thresholdExceeded(); });
+        if (stopped) {
+            break;
+        }
+        const auto isIdle = numCommits > numCommitsCheckpointed &&
+                            std::chrono::steady_clock::now() - lastCommitTime >= IDLE_TIME;
+        if (!thresholdExceeded() && !isIdle) {
+            continue;
+        }
+        const auto numCommitsToCheckpoint = numCommits;
+        lck.unlock();
+        const auto checkpointed = tryCheckpoint();
+        lck.lock();
+        if (checkpointed) {
+            numCommitsCheckpointed = numCommitsToCheckpoint;
+        } else {
+            // Back off before retrying, as transactions are likely still active.
+            cv.wait_for(lck, IDLE_TIME, [&]() { return stopped; });
+        }
+    }
+}
+
+bool BackgroundCheckpointer::tryCheckpoint() const {
+    try {
+        main::ClientContext clientContext(&database);
+        return database.getTransactionManager()->tryCheckpoint(clientContext);
+    } catch (...) { // NOLINT
+        // A failed checkpoint is rolled back by the transaction manager. We retry later, and once
+        // the WAL grows past the hard limit, commits checkpoint inline and surface the error.
+        return false;
+    }
+}
+
+} // namespace transaction
+} // namespace kuzu
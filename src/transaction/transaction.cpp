@@ -34,7 +34,8 @@ Transaction::Transaction(main::ClientContext& clientContext, TransactionType tra
     undoBuffer = std::make_unique<storage::UndoBuffer>(storage::MemoryManager::Get(clientContext));
     currentTS = common::Timestamp::getCurrentTimestamp().value;
     localWAL = std::make_unique<storage::LocalWAL>(*storage::MemoryManager::Get(clientContext),
-        clientContext.getDBConfig()->enableChecksums);
+        clientContext.getDBConfig()->enableChecksums,
+        clientContext.getDBConfig()->enableWALCompression);
 }
 
 Transaction::Transaction(TransactionType transactionType) noexcept
@@ -75,6 +76,11 @@ void Transaction::commit(storage::WAL* wal) {
     }
 }
 
+void Transaction::garbageCollectVersions() const {
+    KU_ASSERT(commitTS != common::INVALID_TRANSACTION);
+    undoBuffer->garbageCollectVersions();
+}
+
 void Transaction::rollback(storage::WAL*) {
     // Rolling back the local storage will free + evict all optimistically-allocated pages
     // Since the undo buffer may do some scanning (e.g. to delete inserted keys from the hash index)
@@ -3,6 +3,9 @@
 #include "common/exception/transaction_manager.h"
 #include "main/client_context.h"
 #include "main/database.h"
+#include "main/materialized_view.h"
+#include "main/result_cache.h"
+#include "storage/local_storage/local_storage.h"
 #include "transaction/transaction_manager.h"
 
 using namespace kuzu::common;
@@ -56,7 +59,23 @@ void TransactionContext::commit() {
     if (!hasActiveTransaction()) {
         return;
     }
-    clientContext.getDatabase()->getTransactionManager()->commit(clientContext, activeTransaction);
+    table_id_set_t changedTableIDs;
+    if (activeTransaction->isWriteTransaction()) {
+        maintainMaterializedViews();
+        changedTableIDs = activeTransaction->getLocalStorage()->getChangedTableIDs();
+    }
+    // Cached results reading the changed tables are dropped before the changes become visible, and
+    // results computed concurrently with the commit are not cached.
+    const auto resultCache = clientContext.getDatabase()->getResultCache();
+    resultCache->startInvalidation(changedTableIDs);
+    try {
+        clientContext.getDatabase()->getTransactionManager()->commit(clientContext,
+            activeTransaction);
+    } catch (std::exception&) {
+        resultCache->finishInvalidation(changedTableIDs);
+        throw;
+    }
+    resultCache->finishInvalidation(changedTableIDs);
     clearTransaction();
 }
 
@@ -69,6 +88,20 @@ void TransactionContext::rollback() {
     clearTransaction();
 }
 
+void TransactionContext::maintainMaterializedViews() {
+    // Views are maintained by statements executed in the committing transaction, so that a view
+    // and its base tables change atomically. These statements must not commit the transaction.
+    const auto prevMode = mode;
+    mode = TransactionMode::MANUAL;
+    try {
+        main::MaterializedViewMaintainer(clientContext).maintain();
+    } catch (std::exception&) {
+        rollback();
+        throw;
+    }
+    mode = prevMode;
+}
+
 void TransactionContext::clearTransaction() {
     activeTransaction = nullptr;
     mode = TransactionMode::AUTO;
@@ -9,6 +9,7 @@
 #include "main/database.h"
 #include "main/db_config.h"
 #include "storage/checkpointer.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/wal/local_wal.h"
 
 using namespace kuzu::common;
@@ -65,8 +66,28 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
         lastTimestamp++;
         transaction->commitTS = lastTimestamp;
         transaction->commit(&wal);
-        auto shouldCheckpoint = transaction->shouldForceCheckpoint() ||
-                                Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        {
+            std::unique_lock tableCommitTSLck{mtxForTableCommitTS};
+            for (auto tableID : transaction->getLocalStorage()->getChangedTableIDs()) {
+                tableLastCommitTS[tableID] = lastTimestamp;
+            }
+        }
+        if (activeTransactions.size() == 1) {
+            // No other transaction is active and new transactions can't start before we release
+            // the lock, so versions committed so far are visible to all future transactions.
+            transaction->garbageCollectVersions();
+        }
+        const auto canAutoCheckpoint = Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        auto shouldCheckpoint = transaction->shouldForceCheckpoint() || canAutoCheckpoint;
+        if (!transaction->shouldForceCheckpoint() && !transaction->isRecovery() &&
+            backgroundCheckpointer && clientContext.getDBConfig()->autoCheckpoint &&
+            clientContext.getDBConfig()->backgroundCheckpoint) {
+            // Leave the checkpoint to the background checkpointer, unless it has fallen so far
+            // behind that we apply back-pressure on writers by checkpointing inline.
+            shouldCheckpoint =
+                canAutoCheckpoint && Checkpointer::exceedsWALHardLimit(clientContext);
+            backgroundCheckpointer->notifyCommit(canAutoCheckpoint);
+        }
         clearTransactionNoLock(transaction->getID());
         if (shouldCheckpoint) {
             checkpointNoLock(clientContext);
@@ -80,6 +101,11 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
     }
 }
 
+transaction_t TransactionManager::getLastCommitTS(table_id_t tableID) {
+    std::unique_lock lck{mtxForTableCommitTS};
+    return tableLastCommitTS.contains(tableID) ? tableLastCommitTS.at(tableID) : 0;
+}
+
 // Note: We take in additional `transaction` here is due to that `transactionContext` might be
 // destructed when a transaction throws an exception, while we need to roll back the active
 // transaction still.
@@ -109,6 +135,15 @@ void TransactionManager::checkpoint(main::ClientContext& clientContext) {
     checkpointNoLock(clientContext);
 }
 
+bool TransactionManager::tryCheckpoint(main::ClientContext& clientContext) {
+    UniqLock lck{mtxForSerializingPublicFunctionCalls};
+    if (!hasNoActiveTransactions()) {
+        return false;
+    }
+    checkpointNoLock(clientContext);
+    return true;
+}
+
 TransactionManager* TransactionManager::Get(const main::ClientContext& context) {
     if (context.getAttachedDatabase() != nullptr) {
         context.getAttachedDatabase()->getTransactionManager();
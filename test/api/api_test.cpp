@@ -546,3 +546,35 @@ TEST_F(ApiTest, DBFileUnderNonExistingDir) {
     // Attempt to open the database with the empty file.
     ASSERT_THROW(std::make_unique<Database>(databasePath, *systemConfig), IOException);
 }
+
+TEST_F(ApiTest, PlanCacheKeyRespectsComments) {
+    auto getResult = [&](const std::string& query) {
+        auto result = conn->query(query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    };
+    // The newline ends the comment, so the first query adds one while the second doesn't.
+    ASSERT_EQ(getResult("RETURN 1 // x\n+ 1;"), 2);
+    ASSERT_EQ(getResult("RETURN 1 // x + 1;"), 1);
+    ASSERT_EQ(getResult("RETURN 1 // x\n+ 1;"), 2);
+    // Quotes inside comments don't start a string.
+    ASSERT_EQ(getResult("RETURN 1 /* it's */ + 1;"), 2);
+    ASSERT_EQ(getResult("RETURN 1 /* it's */ + 1 // '\n+ 1;"), 3);
+    ASSERT_EQ(getResult("RETURN 1 /* it's */ + 1 // ' + 1;"), 2);
+}
+
+TEST_F(ApiTest, ResultCacheKeyRespectsComments) {
+    auto getResult = [&](const std::string& query) {
+        auto result = conn->query(query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    };
+    ASSERT_TRUE(conn->query("CALL result_cache_size=16777216;")->isSuccess());
+    ASSERT_EQ(getResult("RETURN 1 // x\n+ 1;"), 2);
+    ASSERT_EQ(getResult("RETURN 1 // x + 1;"), 1);
+    ASSERT_EQ(getResult("RETURN 1 // x\n+ 1;"), 2);
+    ASSERT_EQ(getResult("RETURN 1 // x + 1;"), 1);
+    // Both queries are cached under distinct keys, so the repeated queries are hits.
+    ASSERT_EQ(getResult("CALL result_cache_info() RETURN num_entries;"), 2);
+    ASSERT_EQ(getResult("CALL result_cache_info() RETURN num_hits;"), 2);
+}
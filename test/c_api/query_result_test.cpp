@@ -171,6 +171,9 @@ TEST_F(CApiQueryResultTest, GetQuerySummary) {
     ASSERT_EQ(state, KuzuSuccess);
     auto compilingTime = kuzu_query_summary_get_compiling_time(&summary);
     ASSERT_GT(compilingTime, 0);
+    auto planningTime = kuzu_query_summary_get_planning_time(&summary);
+    ASSERT_GT(planningTime, 0);
+    ASSERT_LE(planningTime, compilingTime);
     auto executionTime = kuzu_query_summary_get_execution_time(&summary);
     ASSERT_GT(executionTime, 0);
     kuzu_query_summary_destroy(&summary);
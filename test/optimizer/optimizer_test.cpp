@@ -1,4 +1,5 @@
 #include "graph_test/private_graph_test.h"
+#include "planner/operator/logical_common_subplan.h"
 #include "planner/operator/logical_plan_util.h"
 #include "test_runner/test_runner.h"
 
@@ -17,6 +18,21 @@ public:
     std::unique_ptr<planner::LogicalPlan> getRoot(const std::string& query) {
         return TestRunner::getLogicalPlan(query, *conn);
     }
+    static void collectOps(planner::LogicalOperator* op, planner::LogicalOperatorType type,
+        std::vector<planner::LogicalOperator*>& result) {
+        if (op->getOperatorType() == type) {
+            result.push_back(op);
+        }
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            collectOps(op->getChild(i).get(), type, result);
+        }
+    }
+    std::vector<planner::LogicalOperator*> getOpsWithType(const planner::LogicalPlan& plan,
+        planner::LogicalOperatorType type) {
+        std::vector<planner::LogicalOperator*> result;
+        collectOps(plan.getLastOperator().get(), type, result);
+        return result;
+    }
 };
 
 TEST_F(OptimizerTest, JoinHint) {
@@ -189,6 +205,22 @@ TEST_F(OptimizerTest, PlanUndirectedInnerJoin) {
                 (encodedPlan == "HJ(a._ID){E(a)S(b)}{S(a)}"));
 }
 
+TEST_F(OptimizerTest, GreedyJoinOrderFallback) {
+    if (common::DEFAULT_EXTEND_DIRECTION != common::ExtendDirection::BOTH) {
+        GTEST_SKIP();
+    }
+    // Two triangles linked by (c)-[]->(d) have 13 variables, more than MAX_LEVEL_TO_PLAN_EXACTLY.
+    // Approximate levels only extend a plan by one variable at a time, so the plan joining the two
+    // separately built triangles on d can only come from greedy operator ordering.
+    auto q1 = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person), (a)-[:knows]->(c), "
+              "(c)-[:knows]->(d:person)-[:knows]->(e:person)-[:knows]->(f:person), "
+              "(d)-[:knows]->(f) RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q1).c_str(),
+        "HJ(d._ID)"
+        "{HJ(c._ID){E(d)S(c)}{HJ(b._ID,c._ID){HJ(a._ID){E(a)S(b)}{E(c)S(a)}}{E(c)S(b)}}}"
+        "{HJ(e._ID,f._ID){HJ(d._ID){E(d)S(e)}{E(f)S(d)}}{E(f)S(e)}}");
+}
+
 TEST_F(OptimizerTest, SubqueryHint) {
     auto q1 = "MATCH (a:person) WITH * MATCH (a)-[e:knows]->(b:person) WHERE b.ID > 0 HINT (a JOIN "
               "e) JOIN b RETURN *;";
@@ -211,5 +243,64 @@ TEST_F(OptimizerTest, SubqueryHint) {
     ASSERT_STREQ(getEncodedPlan(q6).c_str(), "Filter()HJ(a._ID){S(a)}{E(a)Filter()S(b)}");
 }
 
+TEST_F(OptimizerTest, BloomFilterSIP) {
+    // The join key a.fName is not a node ID, so no semi mask applies. A bloom filter is built on
+    // the small organisation side of the join and probed right on top of the scan producing the
+    // key on the other.
+    auto plan = getRoot("MATCH (a:person)-[:knows]->(b:person), (o:organisation) "
+                        "WHERE o.ID = 1 AND a.fName = o.name RETURN a.fName, b.fName");
+    auto builders = getOpsWithType(*plan, planner::LogicalOperatorType::BLOOM_FILTER_BUILDER);
+    auto probes = getOpsWithType(*plan, planner::LogicalOperatorType::BLOOM_FILTER_PROBE);
+    ASSERT_FALSE(builders.empty());
+    ASSERT_EQ(builders.size(), probes.size());
+    for (auto probe : probes) {
+        auto childType = probe->getChild(0)->getOperatorType();
+        EXPECT_TRUE(childType == planner::LogicalOperatorType::SCAN_NODE_TABLE ||
+                    childType == planner::LogicalOperatorType::EXTEND ||
+                    childType == planner::LogicalOperatorType::TABLE_FUNCTION_CALL);
+    }
+}
+
+TEST_F(OptimizerTest, CommonSubplanMaterializedOnce) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.fName, b.fName UNION ALL "
+                 "MATCH (c:person)-[:knows]->(d:person) RETURN c.fName, d.fName";
+    auto plan = getRoot(query);
+    auto subplans = getOpsWithType(*plan, planner::LogicalOperatorType::COMMON_SUBPLAN);
+    ASSERT_EQ(2u, subplans.size());
+    auto subplanID = subplans[0]->constCast<planner::LogicalCommonSubplan>().getSubplanID();
+    EXPECT_EQ(subplanID, subplans[1]->constCast<planner::LogicalCommonSubplan>().getSubplanID());
+    // Both occurrences scan one materialized result, so knows is scanned and collected once.
+    auto result = conn->query(std::string("EXPLAIN ") + query);
+    ASSERT_TRUE(result->isSuccess());
+    auto physicalPlan = result->getNext()->getValue(0)->toString();
+    auto countOccurrences = [&](const std::string& name) {
+        uint64_t count = 0;
+        for (auto pos = physicalPlan.find(name); pos != std::string::npos;
+             pos = physicalPlan.find(name, pos + name.size())) {
+            count++;
+        }
+        return count;
+    };
+    EXPECT_EQ(1u, countOccurrences("SCAN_REL_TABLE"));
+}
+
+TEST_F(OptimizerTest, ParallelJoinOrderMatchesSerial) {
+    // Levels of this query graph join more subgraph pairs than
+    // MIN_NUM_SUBGRAPH_PAIRS_TO_PLAN_IN_PARALLEL, so they are planned concurrently with multiple
+    // threads.
+    auto query = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person)-[:knows]->(d:person)"
+                 "-[:knows]->(e:person)-[:knows]->(a), (a)-[:knows]->(c), (b)-[:knows]->(d) "
+                 "RETURN COUNT(*)";
+    conn->setMaxNumThreadForExec(1);
+    auto serialPlan = getRoot(query);
+    for (auto numThreads : {2u, 4u}) {
+        conn->setMaxNumThreadForExec(numThreads);
+        auto parallelPlan = getRoot(query);
+        EXPECT_EQ(planner::LogicalPlanUtil::encodeJoin(*serialPlan),
+            planner::LogicalPlanUtil::encodeJoin(*parallelPlan));
+        EXPECT_EQ(serialPlan->getCost(), parallelPlan->getCost());
+    }
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -34,6 +34,19 @@ public:
         }
         return getOpWithType(op->getChild(0).get(), type);
     }
+    // Unlike getOpWithType, also searches the build sides of joins.
+    planner::LogicalOperator* findOpWithType(planner::LogicalOperator* op,
+        planner::LogicalOperatorType type) {
+        if (op->getOperatorType() == type) {
+            return op;
+        }
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            if (auto result = findOpWithType(op->getChild(i).get(), type)) {
+                return result;
+            }
+        }
+        return nullptr;
+    }
 };
 
 TEST_F(CardinalityTest, TestOperators) {
@@ -112,7 +125,11 @@ TEST_F(CardinalityTest, TestOperators) {
         auto* intersect =
             getOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::INTERSECT);
         ASSERT_NE(nullptr, intersect);
-        EXPECT_EQ(intersect->getCardinality(), 1);
+        // Intersect used to be estimated as a filter on its 14 probe tuples, which gave 1 although
+        // the query returns 24 rows. It is now estimated from the lengths of the intersected
+        // lists: each probe tuple intersects two lists of 14 / 8 = 1.75 knows rels over 8
+        // persons, giving 14 * 1.75 * 1.75 / 8 = 5.
+        EXPECT_EQ(intersect->getCardinality(), 5);
 
         auto* flatten =
             getOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::FLATTEN);
@@ -150,5 +167,79 @@ TEST_F(CardinalityTest, TestPopulatedAfterOptimizations) {
     checkFunc(plan->getLastOperator().get());
 }
 
+TEST_F(CardinalityTest, TestHistogramAfterAnalyze) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE A(id INT64, x INT64, PRIMARY KEY (id));")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE B(id INT64, y INT64, PRIMARY KEY (id));")
+                    ->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(0, 999) AS i CREATE (:A {id: i, x: i % 100});")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 199) AS i CREATE (:B {id: i, y: i});")->isSuccess());
+    auto getFilterCardinality = [&](const std::string& predicate) {
+        auto plan = getRoot("EXPLAIN LOGICAL MATCH (a:A) WHERE " + predicate + " RETURN a.id");
+        auto filter =
+            getOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::FILTER);
+        EXPECT_NE(nullptr, filter);
+        return filter->getCardinality();
+    };
+    auto getJoinCardinality = [&]() {
+        auto plan = getRoot("EXPLAIN LOGICAL MATCH (a:A), (b:B) WHERE a.x = b.y RETURN a.id");
+        auto join =
+            getOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::HASH_JOIN);
+        EXPECT_NE(nullptr, join);
+        return join->getCardinality();
+    };
+    // Without histograms, fixed selectivities are used.
+    EXPECT_EQ(100, getFilterCardinality("a.x < 50"));
+    EXPECT_EQ(2000, getJoinCardinality());
+
+    ASSERT_TRUE(conn->query("CALL analyze('A');")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL analyze('B');")->isSuccess());
+    EXPECT_NEAR(500, getFilterCardinality("a.x < 50"), 25);
+    EXPECT_NEAR(800, getFilterCardinality("a.x >= 20"), 25);
+    EXPECT_NEAR(10, getFilterCardinality("a.x = 7"), 5);
+    EXPECT_EQ(1, getFilterCardinality("a.x > 1000"));
+    // Only half of the values of B.y appear in A.x.
+    EXPECT_NEAR(1000, getJoinCardinality(), 300);
+
+    // Values inserted after ANALYZE are folded into the histogram.
+    ASSERT_TRUE(conn->query("UNWIND range(1000, 1999) AS i CREATE (:A {id: i, x: i});")
+                    ->isSuccess());
+    EXPECT_NEAR(1000, getFilterCardinality("a.x >= 1000"), 100);
+}
+
+TEST_F(CardinalityTest, TestExtendWithSkewedDegrees) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, g INT64, PRIMARY KEY (id));")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE E(FROM N TO N);")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(0, 999) AS i CREATE (:N {id: i, g: i % 10});")->isSuccess());
+    // Node 0 is a hub connected to all other nodes. Every other node has a single rel.
+    ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE a.id = 0 AND b.id <> 0 CREATE (a)-[:E]->(b);")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE a.id <> 0 AND b.id = (a.id + 1) % 1000 "
+                            "CREATE (a)-[:E]->(b);")
+                    ->isSuccess());
+    // Extend cardinality per filtered node. The filter estimate itself depends on the distinct
+    // count sketch of g, so only the rate is checked.
+    auto getExtensionRate = [&]() {
+        auto plan = getRoot(
+            "EXPLAIN LOGICAL MATCH (a:N)-[:E]->(b:N) WHERE a.g = 3 RETURN a.id, b.id");
+        auto extend =
+            findOpWithType(plan->getLastOperator().get(), planner::LogicalOperatorType::EXTEND);
+        EXPECT_NE(nullptr, extend);
+        return static_cast<double>(extend->getCardinality()) /
+               extend->getChild(0)->getCardinality();
+    };
+    // Before checkpointing, the average degree of 2 is used.
+    EXPECT_NEAR(2, getExtensionRate(), 0.05);
+    ASSERT_TRUE(conn->query("CHECKPOINT;")->isSuccess());
+    // The hub is unlikely to be among the filtered nodes.
+    EXPECT_NEAR(1.1, getExtensionRate(), 0.1);
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -66,6 +66,8 @@ void FSMLeakChecker::checkForLeakedPages(main::Connection* conn) {
         } else if (indexType == "HNSW") {
             dropQuery =
                 common::stringFormat("CALL DROP_VECTOR_INDEX('{}', '{}');", tableName, indexName);
+        } else if (indexType == "MATERIALIZED_VIEW") {
+            dropQuery = common::stringFormat("CALL DROP_MATERIALIZED_VIEW('{}');", indexName);
         } else {
             EXPECT_TRUE(false) << "Unknown index type: " << indexType << " (table=" << tableName
                                << ", index=" << indexName << ")" << std::endl;
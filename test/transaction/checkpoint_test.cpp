@@ -1,4 +1,5 @@
 #include <fstream>
+#include <thread>
 
 #include "api_test/private_api_test.h"
 #include "common/exception/runtime.h"
@@ -307,5 +308,59 @@ TEST_F(FlakyCheckpointerTest, ShadowFileDatabaseIDMismatchCorruptedDB) {
     EXPECT_THROW(createDBAndConn(), InternalException);
 }
 
+class BackgroundCheckpointTest : public PrivateApiTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    bool walFileExists() const {
+        return std::filesystem::exists(StorageUtils::getWALFilePath(databasePath));
+    }
+};
+
+TEST_F(BackgroundCheckpointTest, CheckpointWhenIdle) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CALL force_checkpoint_on_close=false;")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL background_checkpoint=true;")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY);")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 99) AS i CREATE (:test {id: i});")->isSuccess());
+    // The WAL is far below the checkpoint threshold, so the commits don't checkpoint.
+    ASSERT_TRUE(walFileExists());
+    // Once the database has been idle for a while, the background checkpointer checkpoints.
+    for (auto i = 0u; i < 100 && walFileExists(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_FALSE(walFileExists());
+    createDBAndConn();
+    auto res = conn->query("MATCH (a:test) RETURN COUNT(*);");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 100);
+}
+
+TEST_F(BackgroundCheckpointTest, CheckpointInlineAboveHardLimit) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CALL background_checkpoint=true;")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=1;")->isSuccess());
+    // The WAL of this commit is far beyond the hard limit, so the commit checkpoints inline.
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY);")->isSuccess());
+    ASSERT_FALSE(walFileExists());
+}
+
+TEST_F(BackgroundCheckpointTest, NoBackgroundCheckpointerInMemory) {
+    if (!inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_FALSE(database->getTransactionManager()->hasBackgroundCheckpointer());
+    ASSERT_TRUE(conn->query("CALL background_checkpoint=true;")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY);")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 99) AS i CREATE (:test {id: i});")->isSuccess());
+    auto res = conn->query("MATCH (a:test) RETURN COUNT(*);");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 100);
+}
+
 } // namespace testing
 } // namespace kuzu